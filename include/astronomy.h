@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+const int AstronomyHorizonDays = 6; // covers a 5 day forecast that starts part way through today
+
+typedef struct
+{
+    int year; // local date these values are for
+    int yearDay;
+    long day; // the same date as days since 1970-01-01
+    float latitude;
+    float longitude;
+    int sunrise; // local time, minutes after midnight
+    int sunset;
+    int moonAngle; // 0-360, as moonPhase reports it
+    float moonPercentLit;
+    int16_t horizonSunrise[AstronomyHorizonDays]; // local minutes after midnight for today and the following days
+    int16_t horizonSunset[AstronomyHorizonDays];
+} astronomyDay;
+
+// Fills day for the date in timeNow at the location; the station reuses the last day it calculated
+void GetAstronomy(astronomyDay &day, tm *timeNow, double latitude, double longitude);
+void CalculateSunTimes(long firstDay, int numDays, float latitude, float longitude, int16_t sunriseUtc[], int16_t sunsetUtc[]);
+
+// days since 1970-01-01 for a proleptic Gregorian date (newlib has no timegm); inline for the
+// forecast decoders, which build without the rest of this module in the host tools
+inline long DaysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2;
+    const long era = (year >= 0 ? year : year - 399) / 400;
+    const long yearOfEra = year - era * 400;
+    const long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
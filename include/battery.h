@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+enum batteryState
+{
+    BATTERY_NORMAL,
+    BATTERY_LOW,
+    BATTERY_CRITICAL
+};
+
+typedef struct
+{
+    float lowVoltage;      // drop to BATTERY_LOW below this
+    float criticalVoltage; // drop to BATTERY_CRITICAL below this
+    float hysteresis;      // must recover this far above a threshold before stepping back up
+} batteryThresholds;
+
+float ReadBatteryVoltage();
+batteryState UpdateBatteryState(float voltage, const batteryThresholds &thresholds);
+const char *BatteryStateToString(batteryState state);
+
+void LogBatteryVoltage(float voltage, time_t when);
+void PrintBatteryHistory();
@@ -0,0 +1,10 @@
+#pragma once
+#include <Arduino.h>
+
+// Every deep sleep wake is a cold boot, so time spent before setup() (ROM and second stage
+// bootloader, then global constructors) is paid on every update. These record when the
+// constructors started and when setup() was entered so that cost can be watched.
+void MarkSetupStart();
+// Just before esp_deep_sleep_start(), so the next wake can tell how long it took to reach the app
+void MarkSleepStart(uint64_t sleepMicros);
+void PrintBootProfile();
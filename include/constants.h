@@ -1,10 +1,30 @@
 #pragma once
 #include <Arduino.h>
+#include <energy.h>
+#include <forecast.h>
 
 const double HomeLatitude = 51.481312; // where you at; for doing moon phase
 const double HomeLongitude = -3.180500;
 
-const String metOfficeUri = "/public/data/val/wxfcs/all/json/350759?res=3hourly&key="; // replace 350759 nwith your location
+// Where forecasts come from: DataPointSource, or OpenWeatherMapSource with its key as apikey. DataPoint
+// finds each of ForecastLocations below by locationId, OpenWeatherMap by latitude and longitude
+const forecastSource &ForecastProvider = DataPointSource;
+const char *forecastHost = NULL; // NULL for the provider's own server, or the machine running scripts/standin_server.py
+const uint16_t forecastPort = 80;
+const bool RequestGzip = true; // ask for a gzip body, the JSON compresses several times over so the radio is on for less
+const bool BufferHttpBody = true;             // read the body in chunks rather than a byte per socket call; false to compare parse times
+const unsigned long HttpBodyBudgetMs = 15000; // the whole body must arrive within this, or the parse fails as truncated
+// Thin client builds (-D THIN_CLIENT) download the finished screen from scripts/render_proxy.py instead
+const char *renderProxyHost = "192.168.1.10";
+const uint16_t renderProxyPort = 8080;
+const char *renderProxySite = "home"; // this station's entry in the proxy's sites file
+
+// The sites shown, replace 350759 with your DataPoint location. With more than one each gets a compact band of the
+// screen, and the maxNumRecords records are split between them
+const forecastLocation ForecastLocations[] = {
+    {"Home", "350759", HomeLatitude, HomeLongitude},
+    // {"Work", "310069", 51.4545, -2.5879},
+};
 
 const char *Timezone = "GMT0BST,M3.5.0/01,M10.5.0/02"; // Choose your time zone from: https://github.com/nayarsystems/posix_tz_db/blob/master/zones.csv
                                                        // See below for examples
@@ -21,3 +41,20 @@ const char *weekday_D[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 
 // Month
 const char *month_M[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+// Battery: below these voltages the station degrades to save power
+const float BatteryLowVoltage = 3.55;      // LiPo at roughly 20% remaining
+const float BatteryCriticalVoltage = 3.40; // LiPo nearly flat
+const float BatteryHysteresis = 0.05;      // stops flapping between states on a noisy reading
+
+const long SleepDurationLowBattery = 30;      // minutes between updates when the battery is low
+const long SleepDurationCriticalBattery = 60; // minutes between updates when the battery is critical
+
+// Energy model: measured or datasheet average currents per wake phase, used to estimate battery life
+const energyModel EnergyModel = {
+    {40, 120, 100, 45, 50}, // mA in boot, wifi, http, render, refresh (ESP32 plus panel)
+    250,                    // ms of bootloader before millis() starts; the boot profile's "before app" figure
+    0.15,                   // mA in deep sleep, board dependent, measure yours
+    2000                    // mAh usable battery capacity
+};
+const bool ShowEnergyStatusLine = false; // print the last wake's energy estimate at the bottom of the screen, redrawn only when the forecast needs a refresh
@@ -1,5 +1,37 @@
 #pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <U8g2_for_Adafruit_GFX.h>
 #include <weather.h>
 
-void InitDisplay();
-void DisplayWeather(weatherRecord *weatherRecords, int numRecords, tm *timeNow, double latitude, double longitude);
\ No newline at end of file
+typedef struct
+{
+    bool showGraphs;     // temperature and rain graphs
+    bool showMoon;       // moon phase drawing
+    bool partialRefresh; // fast partial panel update instead of a full flashing refresh
+    const char *statusLine; // small text at the bottom of the screen, NULL for none
+} displayOptions;
+
+// What the draw functions draw with: the buffer they draw into and the font state set as they go.
+// Each screen being drawn has its own, so several can be drawn at once
+typedef struct
+{
+    Adafruit_GFX *target; // the panel's page buffer, or any other 1 bpp GFX buffer such as a GFXcanvas1
+    U8G2_FOR_ADAFRUIT_GFX fonts;
+} renderContext;
+
+void BeginRenderContext(renderContext &context, Adafruit_GFX &target);
+// The screens below show sites[0] with the full layout, or with several sites a compact band for each.
+// The whole screen into context's target in one pass, which must hold all Panel::height rows
+void DrawWeather(renderContext &context, const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options);
+// The moon sprite for angle (0-360) with its anchor at x, y; src/moonBench.cpp times it against the old drawing
+void DrawMoon(renderContext &context, int x, int y, int angle);
+
+void InitDisplay(const displayOptions &options);
+// True when the panel already shows what DisplayWeather would draw
+bool DisplayUpToDate(const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options);
+// Draws and refreshes the panel, initialising it only once the frame is known to differ from the one shown
+void DisplayWeather(const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options);
+// A whole 1 bpp screen from the render proxy, rows top to bottom, initialising the panel at the first rows
+bool WriteFrame(Stream &frame, const displayOptions &options);
+void RefreshFrame(); // shows what WriteFrame sent, once the radio is off
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+enum wakePhase
+{
+    PHASE_BOOT,    // app start until the first phase mark, plus anything not covered below
+    PHASE_WIFI,    // WiFi association and NTP
+    PHASE_HTTP,    // forecast request, download and parse
+    PHASE_RENDER,  // drawing into the frame buffer
+    PHASE_REFRESH, // panel update
+    NUM_WAKE_PHASES
+};
+
+typedef struct
+{
+    float phaseMilliAmps[NUM_WAKE_PHASES]; // average current draw in each phase
+    unsigned long bootloaderMillis;        // ROM and second stage bootloader, before millis() starts, at the boot current
+    float sleepMilliAmps;                  // deep sleep current of the whole board
+    float batteryMilliAmpHours;            // usable battery capacity
+} energyModel;
+
+typedef struct
+{
+    float wakeMilliAmpHours;  // charge used while awake
+    float cycleMilliAmpHours; // wake plus the following sleep
+    float projectedDays;      // battery life at this rate
+} energyEstimate;
+
+void BeginPhase(wakePhase phase);
+energyEstimate EstimateEnergy(const energyModel &model, long sleepSeconds);
+void PrintEnergyReport(const energyEstimate &estimate);
+bool LastEnergyEstimate(energyEstimate &estimate);
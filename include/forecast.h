@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <weather.h>
+
+const int maxNumRecords = 40; // 5 days 3 hourly, shared between all the sites shown
+const int MaxForecastSites = 4; // each gets a band of the screen, 120 rows at the least on 800x480
+
+// A site to fetch: DataPoint finds it by the location ID from its site list, OpenWeatherMap by position
+typedef struct
+{
+    const char *name;       // shown above the site's forecast when there are several
+    const char *locationId; // e.g. "350759"
+    double latitude;        // for the sun and moon
+    double longitude;
+} forecastLocation;
+
+// A forecast provider: where its forecast for a location is, and a decoder that reads the response
+// body straight off the network stream into weatherRecords, one period at a time. Everything after the
+// records (the display, its fingerprints, the frame hash) is the same whichever provider filled them
+typedef struct
+{
+    const char *name;
+    const char *host;
+    // the request path for up to maxRecords periods at location
+    void (*formatUri)(char *uri, size_t size, const forecastLocation &location, const char *apikey, int maxRecords);
+    // fills records from body, deserializing one period at a time into doc; how many were read, 0 for a bad body
+    int (*decode)(Stream &body, JsonDocument &doc, weatherRecord *records, int maxRecords);
+} forecastSource;
+
+extern const forecastSource DataPointSource;
+extern const forecastSource OpenWeatherMapSource;
+
+// Holds the largest single period either provider sends, a DataPoint day of eight Reps, rather than a
+// whole response
+const size_t ForecastDocumentSize = 4 * 1024;
+
+// Reads body past "key": and the '[' of the array it names; false if the body ends first
+bool FindArray(Stream &body, const char *key);
+// Reads past the ',' after an array element; false at the array's ']' or the end of the body
+bool NextArrayElement(Stream &body);
+
+// Fills 'records' from a whole DataPoint 3 hourly forecast document, returns how many were read. Periods
+// past maxRecords are dropped. For the host renderer (src/renderProxy.cpp), which has the file at hand.
+int DecodeForecast(JsonObject root, weatherRecord *records, int maxRecords);
@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+#include <panel.h>
+
+// Finds what changed between the last frame shown and a new one, as a few rectangles to partially
+// refresh. Frames are 1 bpp, Panel::stride bytes per row, compared 32 pixels at a time, so every
+// rectangle's x and width are multiples of 32.
+
+// What one more partial refresh costs, in pixels of refreshed area: two rectangles are merged into
+// their bounding box whenever refreshing the extra area is cheaper than the extra refresh
+#ifndef FRAME_DIFF_REFRESH_COST
+#define FRAME_DIFF_REFRESH_COST (Panel::width * 48L)
+#endif
+#ifndef FRAME_DIFF_MAX_RECTS
+#define FRAME_DIFF_MAX_RECTS 8
+#endif
+
+const int FrameDiffWordsPerRow = Panel::width / 32;
+static_assert(Panel::width % 32 == 0, "rows are diffed a 32 bit word at a time");
+
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} frameRect;
+
+typedef struct
+{
+    uint32_t changedPixels;
+    uint8_t rectangles;
+    uint32_t refreshedPixels; // area of the rectangles, changed or not
+    unsigned long micros;     // time spent diffing and merging
+} frameDiffStats;
+
+typedef struct
+{
+    uint32_t changedRows[(Panel::height + 31) / 32]; // bit per row
+    uint8_t firstWord[Panel::height];                // changed words in each changed row
+    uint8_t lastWord[Panel::height];
+    frameDiffStats stats;
+} frameDiff;
+
+void BeginFrameDiff(frameDiff &diff);
+// Compares rows y to y + rows - 1; previous and current hold just those rows
+void DiffFrameRows(frameDiff &diff, int16_t y, int16_t rows, const uint8_t *previous, const uint8_t *current);
+// The changed area as at most maxRects rectangles, top to bottom; 0 when nothing changed
+int FinishFrameDiff(frameDiff &diff, frameRect *rects, int maxRects);
+void PrintFrameDiffStats(const frameDiffStats &stats);
+
+// The last frame shown, kept in a file (LittleFS on the station, mounted under /littlefs)
+bool DiffStoredFrame(const char *path, const uint8_t *frame, frameDiff &diff); // false when there is no stored frame
+bool StoreFrame(const char *path, const uint8_t *frame);
@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+
+// Counts heap allocations when built with HEAP_COUNTER (see the esp32dev_heapcount, render_proxy and
+// parse_bench environments), so code that should not allocate can be checked. Without it the count is always 0.
+// On the host the count is the calling thread's own.
+uint32_t HeapAllocationCount();
+void ReportHeapAllocations(const char *what, uint32_t countBefore);
+
+#if defined(HEAP_LIMIT) && !defined(ARDUINO)
+// Host builds with HEAP_COUNTER and HEAP_LIMIT, which also wrap free (see the fuzz_decoders environment),
+// can hold a thread to the station's heap: between StartHeapLimit and StopHeapLimit it aborts as soon as
+// it holds more than limitBytes allocated in between, C++ new included only without AddressSanitizer
+void StartHeapLimit(size_t limitBytes);
+void StopHeapLimit();
+#endif
@@ -0,0 +1,130 @@
+#pragma once
+#include <stdint.h>
+
+// Sections can be compiled out with build flags, e.g. -D LAYOUT_SHOW_MOON=0
+#ifndef LAYOUT_SHOW_GRAPHS
+#define LAYOUT_SHOW_GRAPHS 1
+#endif
+#ifndef LAYOUT_SHOW_MOON
+#define LAYOUT_SHOW_MOON 1
+#endif
+#ifndef LAYOUT_SHOW_SUN
+#define LAYOUT_SHOW_SUN 1
+#endif
+
+// Bump when the tables below or what a widget draws change, so stations redraw a screen they already show
+const uint16_t LayoutVersion = 2;
+
+enum widgetKind
+{
+    WIDGET_CONDITIONS_NOW, // icon box for the current 3 hour period
+    WIDGET_FORECAST,       // icon box for forecast slot 'slot'
+    WIDGET_SUN,            // sunrise and sunset times
+    WIDGET_MOON,           // moon phase
+    WIDGET_TEMPERATURE_GRAPH,
+    WIDGET_RAIN_GRAPH,
+    WIDGET_STATUS_LINE, // small text in the bottom corner
+    WIDGET_SITE         // one site's band when several share the screen, site 'slot'
+};
+
+typedef struct
+{
+    widgetKind kind;
+    int16_t x; // anchor point, as the widget's draw function expects it
+    int16_t y;
+    int16_t top; // rows the widget draws into, so paged rendering can skip it on other pages
+    int16_t bottom;
+    int16_t width; // only used by widgets that scale: the graphs, and conditions boxes drawn at half size when set
+    int16_t height;
+    uint8_t slot; // which forecast slot a WIDGET_FORECAST shows
+} widget;
+
+#if SCREEN_WIDTH == 800 && SCREEN_HEIGHT == 480
+
+// Before midday: now, midday, 6pm, then the astronomy block, then 9am tomorrow
+constexpr widget LayoutMorning[] = {
+    {WIDGET_CONDITIONS_NOW, 86, 114, 0, 212, 0, 0, 0},
+    {WIDGET_FORECAST, 258, 114, 0, 212, 0, 0, 0},
+    {WIDGET_FORECAST, 430, 114, 0, 212, 0, 0, 1},
+#if LAYOUT_SHOW_SUN
+    {WIDGET_SUN, 533, 50, 25, 100, 0, 0, 0},
+#endif
+#if LAYOUT_SHOW_MOON
+    {WIDGET_MOON, 503, 90, 122, 198, 0, 0, 0},
+#endif
+    {WIDGET_FORECAST, 711, 114, 0, 212, 0, 0, 2},
+#if LAYOUT_SHOW_GRAPHS
+    {WIDGET_TEMPERATURE_GRAPH, 30, 245, 214, 476, 350, 200, 0},
+    {WIDGET_RAIN_GRAPH, 420, 245, 214, 476, 360, 200, 0},
+#endif
+    {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0},
+};
+
+// After midday: now, the astronomy block, then 9am, midday and 6pm tomorrow
+constexpr widget LayoutAfternoon[] = {
+    {WIDGET_CONDITIONS_NOW, 86, 114, 0, 212, 0, 0, 0},
+#if LAYOUT_SHOW_SUN
+    {WIDGET_SUN, 187, 50, 25, 100, 0, 0, 0},
+#endif
+#if LAYOUT_SHOW_MOON
+    {WIDGET_MOON, 157, 90, 122, 198, 0, 0, 0},
+#endif
+    {WIDGET_FORECAST, 367, 114, 0, 212, 0, 0, 0},
+    {WIDGET_FORECAST, 539, 114, 0, 212, 0, 0, 1},
+    {WIDGET_FORECAST, 711, 114, 0, 212, 0, 0, 2},
+#if LAYOUT_SHOW_GRAPHS
+    {WIDGET_TEMPERATURE_GRAPH, 30, 245, 214, 476, 350, 200, 0},
+    {WIDGET_RAIN_GRAPH, 420, 245, 214, 476, 360, 200, 0},
+#endif
+    {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0},
+};
+
+// Several sites: equal bands of rows 0 to SiteBandsBottom, one per site, then the status line
+const int16_t SiteBandsBottom = SCREEN_HEIGHT - 16;
+constexpr widget SiteStatusLine = {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0};
+const int16_t SiteBandPeriodsX = 340; // the periods after now, in columns from here to the right edge
+const int SiteBandPeriods = 6;
+const bool SiteBandIcon = true; // the conditions icon between the site's name and its periods, where the band is tall enough
+const int SiteBandsMax = 4;     // 116 rows each
+
+#elif SCREEN_WIDTH == 400 && SCREEN_HEIGHT == 300
+
+// Ported from the library's Waveshare_4_2 example: a row of forecast boxes over the graphs. There is no
+// room for the astronomy block, so the sun and moon are left out, and the boxes are in the same order
+// morning and afternoon: now, then the three forecast slots
+constexpr widget LayoutMorning[] = {
+    {WIDGET_CONDITIONS_NOW, 50, 0, 0, 118, 98, 118, 0},
+    {WIDGET_FORECAST, 150, 0, 0, 118, 98, 118, 0},
+    {WIDGET_FORECAST, 250, 0, 0, 118, 98, 118, 1},
+    {WIDGET_FORECAST, 350, 0, 0, 118, 98, 118, 2},
+#if LAYOUT_SHOW_GRAPHS
+    {WIDGET_TEMPERATURE_GRAPH, 30, 160, 129, 281, 160, 90, 0},
+    {WIDGET_RAIN_GRAPH, 235, 160, 129, 281, 155, 90, 0},
+#endif
+    {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0},
+};
+
+constexpr widget LayoutAfternoon[] = {
+    {WIDGET_CONDITIONS_NOW, 50, 0, 0, 118, 98, 118, 0},
+    {WIDGET_FORECAST, 150, 0, 0, 118, 98, 118, 0},
+    {WIDGET_FORECAST, 250, 0, 0, 118, 98, 118, 1},
+    {WIDGET_FORECAST, 350, 0, 0, 118, 98, 118, 2},
+#if LAYOUT_SHOW_GRAPHS
+    {WIDGET_TEMPERATURE_GRAPH, 30, 160, 129, 281, 160, 90, 0},
+    {WIDGET_RAIN_GRAPH, 235, 160, 129, 281, 155, 90, 0},
+#endif
+    {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0},
+};
+
+const int16_t SiteBandsBottom = SCREEN_HEIGHT - 16;
+constexpr widget SiteStatusLine = {WIDGET_STATUS_LINE, SCREEN_WIDTH - 5, SCREEN_HEIGHT - 12, SCREEN_HEIGHT - 14, SCREEN_HEIGHT - 1, 0, 0, 0};
+const int16_t SiteBandPeriodsX = 170;
+const int SiteBandPeriods = 3;
+const bool SiteBandIcon = false; // the periods start where the icon would go
+const int SiteBandsMax = 2;      // 142 rows each, the site's text takes about 100
+
+#else
+#error "No layout for this screen size, add LayoutMorning and LayoutAfternoon tables to layout.h"
+#endif
+
+const int NumForecastSlots = 3;
@@ -0,0 +1,54 @@
+#pragma once
+#define ENABLE_GxEPD2_display 1
+#include <GxEPD2_BW.h>
+
+// Pick the panel at build time, e.g. build_flags = -D EPD_PANEL_GDEY075T7
+// Each screen size needs its own layout tables, see layout.h
+#if defined(EPD_PANEL_GDEY075T7)
+typedef GxEPD2_750_GDEY075T7 EpdPanel; // Good Display GDEY075T7
+#define EPD_PANEL_NAME "GDEY075T7"
+#elif defined(EPD_PANEL_YT7)
+typedef GxEPD2_750_YT7 EpdPanel; // Waveshare 7.5" V2 with the newer controller
+#define EPD_PANEL_NAME "750_YT7"
+#elif defined(EPD_PANEL_420)
+typedef GxEPD2_420 EpdPanel; // Waveshare 4.2"
+#define EPD_PANEL_NAME "420"
+#else
+typedef GxEPD2_750_T7 EpdPanel; // Waveshare 7.5" V2
+#define EPD_PANEL_NAME "750_T7"
+#endif
+
+#if defined(EPD_PANEL_420)
+#define SCREEN_WIDTH 400 // Set for landscape mode
+#define SCREEN_HEIGHT 300
+#else
+#define SCREEN_WIDTH 800 // Set for landscape mode
+#define SCREEN_HEIGHT 480
+#endif
+
+// Rows held in RAM at once. 60 rows is 6 KB on the 800x480 panels against 48 KB for the whole frame,
+// for the cost of walking the layout once a page; -D EPD_FULL_PAGE buffers the whole frame instead
+#if defined(EPD_FULL_PAGE)
+#undef EPD_PAGE_HEIGHT
+#define EPD_PAGE_HEIGHT EpdPanel::HEIGHT
+#elif !defined(EPD_PAGE_HEIGHT)
+#define EPD_PAGE_HEIGHT 60
+#endif
+
+template <typename PanelType, uint16_t PageHeight>
+struct panelTraits
+{
+    typedef GxEPD2_BW<PanelType, PageHeight> displayType;
+
+    static constexpr int16_t width = PanelType::WIDTH;
+    static constexpr int16_t height = PanelType::HEIGHT;
+    static constexpr uint16_t stride = PanelType::WIDTH / 8; // bytes per row of the 1 bpp buffer
+    static constexpr uint16_t pageHeight = PageHeight;
+    static constexpr uint16_t pages = (PanelType::HEIGHT + PageHeight - 1) / PageHeight;
+    static constexpr uint32_t bufferBytes = (uint32_t)stride * PageHeight;
+};
+
+typedef panelTraits<EpdPanel, EPD_PAGE_HEIGHT> Panel;
+
+static_assert(Panel::width == SCREEN_WIDTH && Panel::height == SCREEN_HEIGHT, "panel does not match the screen size the layout is drawn for");
+static_assert(Panel::width % 8 == 0, "1 bpp rows must be whole bytes");
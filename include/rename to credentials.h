@@ -6,4 +6,4 @@
 
 const char *ssid = "";            // WiFi SSID to connect to
 const char *password = ""; // WiFi password needed for the SSID
-String apikey = "";        // metoffice apikey
+const char *apikey = "";   // metoffice apikey, or the OpenWeatherMap one with OpenWeatherMapSource
@@ -8,4 +8,14 @@ typedef struct {
 
 } weatherRecord;
 
+// One site's forecast, its records a slice of the station's record array
+typedef struct {
+
+    const char *name;
+    double latitude;
+    double longitude;
+    weatherRecord *records;
+    int numRecords;
+
+} siteForecast;
 
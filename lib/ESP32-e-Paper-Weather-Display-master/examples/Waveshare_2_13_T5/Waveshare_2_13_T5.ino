@@ -199,8 +199,8 @@ void Draw_Main_Weather_Section() {
   //DrawPressureTrend(3, 52, WxConditions[0].Pressure, WxConditions[0].Trend);
   u8g2Fonts.setFont(u8g2_font_helvB12_tf);
   String Wx_Description = WxConditions[0].Forecast0;
-  if (WxConditions[0].Forecast1 != "") Wx_Description += " & " +  WxConditions[0].Forecast1;
-  if (WxConditions[0].Forecast2 != "" && WxConditions[0].Forecast1 != WxConditions[0].Forecast2) Wx_Description += " & " +  WxConditions[0].Forecast2;
+  if (WxConditions[0].Forecast1[0] != '\0') Wx_Description += " & " +  String(WxConditions[0].Forecast1);
+  if (WxConditions[0].Forecast2[0] != '\0' && strcmp(WxConditions[0].Forecast1, WxConditions[0].Forecast2) != 0) Wx_Description += " & " +  String(WxConditions[0].Forecast2);
   drawString(2, 62, TitleCase(Wx_Description), LEFT);
   display.drawLine(0, 72, (5 * 44), 72, GxEPD_BLACK); //Draw width of the 5 weather forcasts
 }
@@ -210,7 +210,7 @@ void Draw_Main_Weather_Section() {
 void Draw_3hr_Forecast(int x, int y, int index) {
   DisplayWXicon(x + 26, y, WxForecast[index].Icon, SmallIcon);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
-  drawString(x + 8, y - 22, WxForecast[index].Period.substring(11, 16), LEFT);
+  drawString(x + 8, y - 22, String(WxForecast[index].Period).substring(11, 16), LEFT);
   drawString(x + 3, y + 15, String(WxForecast[index].High, 0) + "°/" + String(WxForecast[index].Low, 0) + "°", LEFT);
   display.drawLine(x + 44, y - 24, x + 44, y - 24 + 52 , GxEPD_BLACK);
   display.drawLine(x, y - 24 + 52, x + 44, y - 24 + 52 , GxEPD_BLACK);
@@ -218,7 +218,7 @@ void Draw_3hr_Forecast(int x, int y, int index) {
 /*void Draw_3hr_Forecast(int x, int y, int index) {
   DisplayWXicon(x, y, WxForecast[index].Icon, SmallIcon);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
-  drawString(x + 22, y, WxForecast[index].Period.substring(11, 16), CENTER);
+  drawString(x + 22, y, String(WxForecast[index].Period).substring(11, 16), CENTER);
   drawString(x + 22, y + 40, String(WxForecast[index].High, 0) + "°/" + String(WxForecast[index].Low, 0) + "°", CENTER);
   display.drawLine(x + 44, y, x + 44, y + 52 , GxEPD_BLACK);
 }*/
@@ -187,7 +187,7 @@ void Draw_Heading_Section() {
 void DisplayForecastWeather(int x, int y, int forecast, int Dposition, int fwidth) {
   GetForecastDay(WxForecast[forecast].Dt);
   x += fwidth * Dposition;
-  DisplayConditionsSection(x + 10, y, WxForecast[forecast].Icon, SmallIcon);
+  DisplayConditionsSection(x + 10, y, WxForecast[forecast].IconCode, SmallIcon);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
   drawString(x + 8, y - 24, ForecastDay, CENTER);
   drawString(x + 18, y + 12, String(HLReadings[Dposition].High, 0) + "°/" + String(HLReadings[Dposition].Low, 0) + "°", CENTER);
@@ -195,7 +195,7 @@ void DisplayForecastWeather(int x, int y, int forecast, int Dposition, int fwidt
 }
 //#########################################################################################
 void Draw_Main_Weather_Section() {
-  DisplayConditionsSection(205, 45, WxConditions[0].Icon, LargeIcon);
+  DisplayConditionsSection(205, 45, WxConditions[0].IconCode, LargeIcon);
   u8g2Fonts.setFont(u8g2_font_helvB14_tf);
   drawString(3, 33, String(WxConditions[0].Temperature, 1) + "° / " + String(WxConditions[0].Humidity, 0) + "%", LEFT);
   u8g2Fonts.setFont(u8g2_font_helvB10_tf);
@@ -368,18 +368,25 @@ void DrawPressureTrend(int x, int y, float pressure, String slope) {
   }
 }
 //#########################################################################################
-void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
-  Serial.println("Icon name: " + IconName);
-  if      (IconName == "01d" || IconName == "01n")  ClearSky(x, y, IconSize, IconName);
-  else if (IconName == "02d" || IconName == "02n")  FewClouds(x, y, IconSize, IconName);
-  else if (IconName == "03d" || IconName == "03n")  ScatteredClouds(x, y, IconSize, IconName);
-  else if (IconName == "04d" || IconName == "04n")  BrokenClouds(x, y, IconSize, IconName);
-  else if (IconName == "09d" || IconName == "09n")  ChanceRain(x, y, IconSize, IconName);
-  else if (IconName == "10d" || IconName == "10n")  Rain(x, y, IconSize, IconName);
-  else if (IconName == "11d" || IconName == "11n")  Tstorms(x, y, IconSize, IconName);
-  else if (IconName == "13d" || IconName == "13n")  Snow(x, y, IconSize, IconName);
-  else if (IconName == "50d" || IconName == "50n")  Mist(x, y, IconSize, IconName);
-  else                                              Nodata(x, y, IconSize, IconName);
+void DisplayConditionsSection(int x, int y, uint8_t IconCode, bool IconSize) {
+  typedef void (*IconDrawer)(int x, int y, bool IconSize, bool IconNight);
+  // Indexed by IconKind, then day / night, see forecast_record.h
+  static const IconDrawer IconDrawers[ICON_KINDS][2] = {
+    {Nodata,      Nodata},      // ICON_NONE
+    {Sunny,       Sunny},       // ICON_CLEAR
+    {MostlySunny, MostlySunny}, // ICON_FEW_CLOUDS
+    {Cloudy,      Cloudy},      // ICON_SCATTERED_CLOUDS
+    {MostlySunny, MostlySunny}, // ICON_BROKEN_CLOUDS
+    {ChanceRain,  ChanceRain},  // ICON_SHOWER_RAIN
+    {Rain,        Rain},        // ICON_RAIN
+    {Tstorms,     Tstorms},     // ICON_THUNDERSTORM
+    {Snow,        Snow},        // ICON_SNOW
+    {Haze,        Fog}          // ICON_MIST
+  };
+  uint8_t kind  = IconCode & ICON_KIND_MASK;
+  bool    night = IconCode & ICON_NIGHT;
+  if (kind >= ICON_KINDS) kind = ICON_NONE;
+  IconDrawers[kind][night](x, y, IconSize, night);
 }
 //#########################################################################################
 void GetHighsandLows() {
@@ -591,7 +598,7 @@ void addfog(int x, int y, int scale, int linesize, bool IconSize) {
   }
 }
 //#########################################################################################
-void ClearSky(int x, int y, bool IconSize, String IconName) {
+void ClearSky(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small;
   if (IconSize == LargeIcon) {
     scale = Large;
@@ -600,22 +607,22 @@ void ClearSky(int x, int y, bool IconSize, String IconName) {
   else {
     y = y - 5; // Shift down small sun icon
   }
-  if (IconName.endsWith("n")) addmoon(x, y + 3, scale, IconSize);
+  if (IconNight) addmoon(x, y + 3, scale, IconSize);
   scale = scale * 1.6;
   addsun(x, y, scale, IconSize);
 }
 //#########################################################################################
-void FewClouds(int x, int y, bool IconSize, String IconName) {
+void FewClouds(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 1;
   if (IconSize == LargeIcon) {
     scale = Large;
     linesize = 3;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
 }//#########################################################################################
-void ScatteredClouds(int x, int y, bool IconSize, String IconName) {
+void ScatteredClouds(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3, offset = 10;
   if (IconSize == LargeIcon) {
     scale = Large;
@@ -625,13 +632,13 @@ void ScatteredClouds(int x, int y, bool IconSize, String IconName) {
     linesize = 1;
     offset   = 5;
   }
-  if (IconName.endsWith("n")) addmoon(x, y + offset + (IconSize ? -8 : 0), scale, IconSize);
+  if (IconNight) addmoon(x, y + offset + (IconSize ? -8 : 0), scale, IconSize);
   addcloud(x + offset, y - offset * 1.2, scale / 1.5, linesize);
   addcloud(x, y + offset, scale, linesize);
   addsun(x - scale * 1.8, y - scale * 1.8 + offset, scale, IconSize);
 }
 //#########################################################################################
-void BrokenClouds(int x, int y, bool IconSize, String IconName) {
+void BrokenClouds(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3, offset  = 12;
   if (IconSize == LargeIcon) {
     scale = Large;
@@ -641,88 +648,88 @@ void BrokenClouds(int x, int y, bool IconSize, String IconName) {
     linesize = 1;
     offset   = 6;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x - offset, y - offset, scale / 1.5, linesize);
   addcloud(x + offset, y - offset * 1.2, scale / 1.5, linesize);
   addcloud(x, y, scale, linesize);
 }
 //#########################################################################################
-void Rain(int x, int y, bool IconSize, String IconName) {
+void Rain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ChanceRain(int x, int y, bool IconSize, String IconName) {
+void ChanceRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x - (IconSize ? 8 : 0), y, scale, IconSize);
+  if (IconNight) addmoon(x - (IconSize ? 8 : 0), y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ExpectRain(int x, int y, bool IconSize, String IconName) {
+void ExpectRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void Tstorms(int x, int y, bool IconSize, String IconName) {
+void Tstorms(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addtstorm(x, y, scale);
 }
 //#########################################################################################
-void Snow(int x, int y, bool IconSize, String IconName) {
+void Snow(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addsnow(x, y, scale, IconSize);
 }
 //#########################################################################################
-void Mist(int x, int y, bool IconSize, String IconName) {
+void Mist(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
     y = y + 5;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y - 5, scale, linesize);
   addfog(x, y - 2, scale, linesize, IconSize);
 }
 //#########################################################################################
-void Haze(int x, int y, bool IconSize, String IconName) {
+void Haze(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x, y - 2, scale * 1.4, IconSize);
   addfog(x, y + 3 - (IconSize ? 12 : 0), scale * 1.4, linesize, IconSize);
 }
@@ -766,7 +773,7 @@ void addmoon(int x, int y, int scale, bool IconSize) {
   }
 }
 //#########################################################################################
-void Nodata(int x, int y, bool IconSize, String IconName) {
+void Nodata(int x, int y, bool IconSize, bool IconNight) {
   if (IconSize == LargeIcon) u8g2Fonts.setFont(u8g2_font_helvB24_tf); else u8g2Fonts.setFont(u8g2_font_helvB10_tf);
   drawString(x - 3, y - 8, "?", CENTER);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
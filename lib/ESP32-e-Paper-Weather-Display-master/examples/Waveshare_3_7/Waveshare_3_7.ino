@@ -264,8 +264,8 @@ void DrawMainWeatherSection(int x, int y) {
   //Current weather description - rainy, sunny etc.
   String Wx_Description = WxConditions[0].Forecast0;
   u8g2Fonts.setFont(u8g2_font_helvB18_tf);
-  if (WxConditions[0].Forecast1 != "")
-    Wx_Description += " & " + WxConditions[0].Forecast1;
+  if (WxConditions[0].Forecast1[0] != '\0')
+    Wx_Description += " & " + String(WxConditions[0].Forecast1);
 
   drawStringMaxWidth(x + 5, y + 60, 150, TitleCase(Wx_Description), LEFT);
 
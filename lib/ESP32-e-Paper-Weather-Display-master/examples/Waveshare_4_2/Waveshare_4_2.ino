@@ -178,8 +178,8 @@ void DrawMainWeatherSection(int x, int y) {
   DrawPressureAndTrend(x - 120, y + 58, WxConditions[0].Pressure, WxConditions[0].Trend);
   u8g2Fonts.setFont(u8g2_font_helvB12_tf);
   String Wx_Description = WxConditions[0].Forecast0;
-  if (WxConditions[0].Forecast1 != "") Wx_Description += " & " +  WxConditions[0].Forecast1;
-  if (WxConditions[0].Forecast2 != "" && WxConditions[0].Forecast1 != WxConditions[0].Forecast2) Wx_Description += " & " +  WxConditions[0].Forecast2;
+  if (WxConditions[0].Forecast1[0] != '\0') Wx_Description += " & " +  String(WxConditions[0].Forecast1);
+  if (WxConditions[0].Forecast2[0] != '\0' && strcmp(WxConditions[0].Forecast1, WxConditions[0].Forecast2) != 0) Wx_Description += " & " +  String(WxConditions[0].Forecast2);
   drawStringMaxWidth(x - 170, y + 83, 28, TitleCase(Wx_Description), LEFT);
   DrawMainWx(x, y + 60);
   display.drawRect(0, y + 68, 232, 48, GxEPD_BLACK);
@@ -172,7 +172,7 @@ void DisplayGeneralInfoSection() {
 void DisplayMainWeatherSection(int x, int y) {
   //  display.drawRect(x-67, y-65, 140, 182, GxEPD_BLACK);
   display.drawLine(0, 30, SCREEN_WIDTH - 4, 30,  GxEPD_BLACK);
-  DisplayConditionsSection(x + 2, y + 40, WxConditions[0].Icon, LargeIcon);
+  DisplayConditionsSection(x + 2, y + 40, WxConditions[0].IconCode, LargeIcon);
   DisplayTemperatureSection(x + 125, y - 64, 110, 80);
   DisplayPressureSection(x + 230, y - 64, WxConditions[0].Pressure, WxConditions[0].Trend, 105, 80);
   DisplayPrecipitationSection(x + 330, y - 64, 105, 80);
@@ -266,7 +266,7 @@ void DisplayForecastWeather(int x, int y, int index) {
   x = x + fwidth * index;
   display.drawRect(x, y, fwidth - 1, 65, GxEPD_BLACK);
   display.drawLine(x, y + 13, x + fwidth - 3, y + 13, GxEPD_BLACK);
-  DisplayConditionsSection(x + fwidth / 2, y + 35, WxForecast[index].Icon, SmallIcon);
+  DisplayConditionsSection(x + fwidth / 2, y + 35, WxForecast[index].IconCode, SmallIcon);
   drawString(x + fwidth / 2, y + 3, String(ConvertUnixTime(WxForecast[index].Dt + WxConditions[0].Timezone).substring(0,5)), CENTER);
   drawString(x + fwidth / 2, y + 53, String(WxForecast[index].High, 0) + "°/" + String(WxForecast[index].Low, 0) + "°", CENTER);
 }
@@ -422,19 +422,25 @@ void DisplayForecastSection(int x, int y) {
   else DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, Units == "M" ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN, snow_readings, max_readings, autoscale_on, barchart_on);
 }
 //#########################################################################################
-void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
-  Serial.println("Icon name: " + IconName);
-  if      (IconName == "01d" || IconName == "01n")  Sunny(x, y, IconSize, IconName);
-  else if (IconName == "02d" || IconName == "02n")  MostlySunny(x, y, IconSize, IconName);
-  else if (IconName == "03d" || IconName == "03n")  Cloudy(x, y, IconSize, IconName);
-  else if (IconName == "04d" || IconName == "04n")  MostlySunny(x, y, IconSize, IconName);
-  else if (IconName == "09d" || IconName == "09n")  ChanceRain(x, y, IconSize, IconName);
-  else if (IconName == "10d" || IconName == "10n")  Rain(x, y, IconSize, IconName);
-  else if (IconName == "11d" || IconName == "11n")  Tstorms(x, y, IconSize, IconName);
-  else if (IconName == "13d" || IconName == "13n")  Snow(x, y, IconSize, IconName);
-  else if (IconName == "50d")                       Haze(x, y, IconSize, IconName);
-  else if (IconName == "50n")                       Fog(x, y, IconSize, IconName);
-  else                                              Nodata(x, y, IconSize, IconName);
+void DisplayConditionsSection(int x, int y, uint8_t IconCode, bool IconSize) {
+  typedef void (*IconDrawer)(int x, int y, bool IconSize, bool IconNight);
+  // Indexed by IconKind, then day / night, see forecast_record.h
+  static const IconDrawer IconDrawers[ICON_KINDS][2] = {
+    {Nodata,      Nodata},      // ICON_NONE
+    {Sunny,       Sunny},       // ICON_CLEAR
+    {MostlySunny, MostlySunny}, // ICON_FEW_CLOUDS
+    {Cloudy,      Cloudy},      // ICON_SCATTERED_CLOUDS
+    {MostlySunny, MostlySunny}, // ICON_BROKEN_CLOUDS
+    {ChanceRain,  ChanceRain},  // ICON_SHOWER_RAIN
+    {Rain,        Rain},        // ICON_RAIN
+    {Tstorms,     Tstorms},     // ICON_THUNDERSTORM
+    {Snow,        Snow},        // ICON_SNOW
+    {Haze,        Fog}          // ICON_MIST
+  };
+  uint8_t kind  = IconCode & ICON_KIND_MASK;
+  bool    night = IconCode & ICON_NIGHT;
+  if (kind >= ICON_KINDS) kind = ICON_NONE;
+  IconDrawers[kind][night](x, y, IconSize, night);
   if (IconSize == LargeIcon) {
     display.drawRect(x - 69, y - 105, 140, 182, GxEPD_BLACK);
     u8g2Fonts.setFont(u8g2_font_helvB08_tf);
@@ -679,131 +685,131 @@ void addfog(int x, int y, int scale, int linesize, bool IconSize) {
   }
 }
 //#########################################################################################
-void Sunny(int x, int y, bool IconSize, String IconName) {
+void Sunny(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small;
   if (IconSize == LargeIcon) scale = Large;
   else y = y - 3; // Shift up small sun icon
-  if (IconName.endsWith("n")) addmoon(x, y + 3, scale, IconSize);
+  if (IconNight) addmoon(x, y + 3, scale, IconSize);
   scale = scale * 1.6;
   addsun(x, y, scale, IconSize);
 }
 //#########################################################################################
-void MostlySunny(int x, int y, bool IconSize, String IconName) {
+void MostlySunny(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3, offset = 5;
   if (IconSize == LargeIcon) {
     scale = Large;
     offset = 10;
   }
   if (scale == Small) linesize = 1;
-  if (IconName.endsWith("n")) addmoon(x, y + offset, scale, IconSize);
+  if (IconNight) addmoon(x, y + offset, scale, IconSize);
   addcloud(x, y + offset, scale, linesize);
   addsun(x - scale * 1.8, y - scale * 1.8 + offset, scale, IconSize);
 }
 //#########################################################################################
-void MostlyCloudy(int x, int y, bool IconSize, String IconName) {
+void MostlyCloudy(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3;
   if (IconSize == LargeIcon) {
     scale = Large;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
 }
 //#########################################################################################
-void Cloudy(int x, int y, bool IconSize, String IconName) {
+void Cloudy(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
-    if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+    if (IconNight) addmoon(x, y, scale, IconSize);
     linesize = 1;
     addcloud(x, y, scale, linesize);
   }
   else {
     y += 10;
-    if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+    if (IconNight) addmoon(x, y, scale, IconSize);
     addcloud(x + 30, y - 45, 5, linesize); // Cloud top right
     addcloud(x - 20, y - 30, 7, linesize); // Cloud top left
     addcloud(x, y, scale, linesize);       // Main cloud
   }
 }
 //#########################################################################################
-void Rain(int x, int y, bool IconSize, String IconName) {
+void Rain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ExpectRain(int x, int y, bool IconSize, String IconName) {
+void ExpectRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ChanceRain(int x, int y, bool IconSize, String IconName) {
+void ChanceRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void Tstorms(int x, int y, bool IconSize, String IconName) {
+void Tstorms(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addtstorm(x, y, scale);
 }
 //#########################################################################################
-void Snow(int x, int y, bool IconSize, String IconName) {
+void Snow(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addsnow(x, y, scale, 5, IconSize);
 }
 //#########################################################################################
-void Fog(int x, int y, bool IconSize, String IconName) {
+void Fog(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y - 5, scale, linesize);
   addfog(x, y - 5, scale, linesize, IconSize);
 }
 //#########################################################################################
-void Haze(int x, int y, bool IconSize, String IconName) {
+void Haze(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x, y - 5, scale * 1.4, IconSize);
   addfog(x, y - 5, scale * 1.4, linesize, IconSize);
 }
@@ -846,7 +852,7 @@ void addmoon(int x, int y, int scale, bool IconSize) {
   }
 }
 //#########################################################################################
-void Nodata(int x, int y, bool IconSize, String IconName) {
+void Nodata(int x, int y, bool IconSize, bool IconNight) {
   if (IconSize == LargeIcon) u8g2Fonts.setFont(u8g2_font_helvB24_tf); else u8g2Fonts.setFont(u8g2_font_helvB10_tf);
   drawString(x - 3, y - 8, "?", CENTER);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
@@ -175,7 +175,7 @@ void DisplayGeneralInfoSection() {
 void DisplayMainWeatherSection(int x, int y) {
   //  display.drawRect(x-67, y-65, 140, 182, GxEPD_BLACK);
   display.drawLine(0, 38, SCREEN_WIDTH - 3, 38,  GxEPD_BLACK);
-  DisplayConditionsSection(x + 3, y + 49, WxConditions[0].Icon, LargeIcon);
+  DisplayConditionsSection(x + 3, y + 49, WxConditions[0].IconCode, LargeIcon);
   DisplayTemperatureSection(x + 154, y - 81, 137, 100);
   DisplayPressureSection(x + 281, y - 81, WxConditions[0].Pressure, WxConditions[0].Trend, 137, 100);
   DisplayPrecipitationSection(x + 411, y - 81, 137, 100);
@@ -255,9 +255,9 @@ void DisplayForecastTextSection(int x, int y , int fwidth, int fdepth) {
   display.drawRect(x - 6, y - 3, fwidth, fdepth, GxEPD_BLACK); // forecast text outline
   u8g2Fonts.setFont(u8g2_font_helvB14_tf);
   String Wx_Description = WxConditions[0].Main0;
-  if (WxConditions[0].Forecast0 != "") Wx_Description += " (" + WxConditions[0].Forecast0;
-  if (WxConditions[0].Forecast1 != "") Wx_Description += ", " + WxConditions[0].Forecast1;
-  if (WxConditions[0].Forecast2 != "") Wx_Description += ", " + WxConditions[0].Forecast2;
+  if (WxConditions[0].Forecast0[0] != '\0') Wx_Description += " (" + String(WxConditions[0].Forecast0);
+  if (WxConditions[0].Forecast1[0] != '\0') Wx_Description += ", " + String(WxConditions[0].Forecast1);
+  if (WxConditions[0].Forecast2[0] != '\0') Wx_Description += ", " + String(WxConditions[0].Forecast2);
   if (Wx_Description.indexOf("(") > 0) Wx_Description += ")";
   int MsgWidth = 43; // Using proportional fonts, so be aware of making it too wide!
   if (Language == "DE") drawStringMaxWidth(x, y + 23, MsgWidth, Wx_Description, LEFT); // Leave German text in original format, 28 character screen width at this font size
@@ -270,7 +270,7 @@ void DisplayForecastWeather(int x, int y, int index) {
   x = x + fwidth * index;
   display.drawRect(x, y, fwidth - 1, 81, GxEPD_BLACK);
   display.drawLine(x, y + 16, x + fwidth - 3, y + 16, GxEPD_BLACK);
-  DisplayConditionsSection(x + fwidth / 2, y + 43, WxForecast[index].Icon, SmallIcon);
+  DisplayConditionsSection(x + fwidth / 2, y + 43, WxForecast[index].IconCode, SmallIcon);
   drawString(x + fwidth / 2, y + 4, String(ConvertUnixTime(WxForecast[index].Dt + WxConditions[0].Timezone).substring(0, 5)), CENTER);
   drawString(x + fwidth / 2 + 12, y + 66, String(WxForecast[index].High, 0) + "°/" + String(WxForecast[index].Low, 0) + "°", CENTER);
 }
@@ -418,19 +418,25 @@ void DisplayForecastSection(int x, int y) {
   else DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, Units == "M" ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN, snow_readings, max_readings, autoscale_on, barchart_on);
 }
 //#########################################################################################
-void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
-  Serial.println("Icon name: " + IconName);
-  if      (IconName == "01d" || IconName == "01n")  Sunny(x, y, IconSize, IconName);
-  else if (IconName == "02d" || IconName == "02n")  MostlySunny(x, y, IconSize, IconName);
-  else if (IconName == "03d" || IconName == "03n")  Cloudy(x, y, IconSize, IconName);
-  else if (IconName == "04d" || IconName == "04n")  MostlySunny(x, y, IconSize, IconName);
-  else if (IconName == "09d" || IconName == "09n")  ChanceRain(x, y, IconSize, IconName);
-  else if (IconName == "10d" || IconName == "10n")  Rain(x, y, IconSize, IconName);
-  else if (IconName == "11d" || IconName == "11n")  Tstorms(x, y, IconSize, IconName);
-  else if (IconName == "13d" || IconName == "13n")  Snow(x, y, IconSize, IconName);
-  else if (IconName == "50d")                       Haze(x, y, IconSize, IconName);
-  else if (IconName == "50n")                       Fog(x, y, IconSize, IconName);
-  else                                              Nodata(x, y, IconSize, IconName);
+void DisplayConditionsSection(int x, int y, uint8_t IconCode, bool IconSize) {
+  typedef void (*IconDrawer)(int x, int y, bool IconSize, bool IconNight);
+  // Indexed by IconKind, then day / night, see forecast_record.h
+  static const IconDrawer IconDrawers[ICON_KINDS][2] = {
+    {Nodata,      Nodata},      // ICON_NONE
+    {Sunny,       Sunny},       // ICON_CLEAR
+    {MostlySunny, MostlySunny}, // ICON_FEW_CLOUDS
+    {Cloudy,      Cloudy},      // ICON_SCATTERED_CLOUDS
+    {MostlySunny, MostlySunny}, // ICON_BROKEN_CLOUDS
+    {ChanceRain,  ChanceRain},  // ICON_SHOWER_RAIN
+    {Rain,        Rain},        // ICON_RAIN
+    {Tstorms,     Tstorms},     // ICON_THUNDERSTORM
+    {Snow,        Snow},        // ICON_SNOW
+    {Haze,        Fog}          // ICON_MIST
+  };
+  uint8_t kind  = IconCode & ICON_KIND_MASK;
+  bool    night = IconCode & ICON_NIGHT;
+  if (kind >= ICON_KINDS) kind = ICON_NONE;
+  IconDrawers[kind][night](x, y, IconSize, night);
   if (IconSize == LargeIcon) {
     display.drawRect(x - 86, y - 131, 173, 228, GxEPD_BLACK);
     u8g2Fonts.setFont(u8g2_font_helvB08_tf);
@@ -675,131 +681,131 @@ void addfog(int x, int y, int scale, int linesize, bool IconSize) {
   }
 }
 //#########################################################################################
-void Sunny(int x, int y, bool IconSize, String IconName) {
+void Sunny(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small;
   if (IconSize == LargeIcon) scale = Large;
   else y = y - 3; // Shift up small sun icon
-  if (IconName.endsWith("n")) addmoon(x, y + 3, scale, IconSize);
+  if (IconNight) addmoon(x, y + 3, scale, IconSize);
   scale = scale * 1.6;
   addsun(x, y, scale, IconSize);
 }
 //#########################################################################################
-void MostlySunny(int x, int y, bool IconSize, String IconName) {
+void MostlySunny(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3, offset = 5;
   if (IconSize == LargeIcon) {
     scale = Large;
     offset = 10;
   }
   if (scale == Small) linesize = 1;
-  if (IconName.endsWith("n")) addmoon(x, y + offset, scale, IconSize);
+  if (IconNight) addmoon(x, y + offset, scale, IconSize);
   addcloud(x, y + offset, scale, linesize);
   addsun(x - scale * 1.8, y - scale * 1.8 + offset, scale, IconSize);
 }
 //#########################################################################################
-void MostlyCloudy(int x, int y, bool IconSize, String IconName) {
+void MostlyCloudy(int x, int y, bool IconSize, bool IconNight) {
   int scale = Small, linesize = 3;
   if (IconSize == LargeIcon) {
     scale = Large;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
 }
 //#########################################################################################
-void Cloudy(int x, int y, bool IconSize, String IconName) {
+void Cloudy(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
-    if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+    if (IconNight) addmoon(x, y, scale, IconSize);
     linesize = 1;
     addcloud(x, y, scale, linesize);
   }
   else {
     y += 10;
-    if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+    if (IconNight) addmoon(x, y, scale, IconSize);
     addcloud(x + 30, y - 45, 5, linesize); // Cloud top right
     addcloud(x - 20, y - 30, 7, linesize); // Cloud top left
     addcloud(x, y, scale, linesize);       // Main cloud
   }
 }
 //#########################################################################################
-void Rain(int x, int y, bool IconSize, String IconName) {
+void Rain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ExpectRain(int x, int y, bool IconSize, String IconName) {
+void ExpectRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void ChanceRain(int x, int y, bool IconSize, String IconName) {
+void ChanceRain(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x - scale * 1.8, y - scale * 1.8, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addrain(x, y, scale, IconSize);
 }
 //#########################################################################################
-void Tstorms(int x, int y, bool IconSize, String IconName) {
+void Tstorms(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addtstorm(x, y, scale);
 }
 //#########################################################################################
-void Snow(int x, int y, bool IconSize, String IconName) {
+void Snow(int x, int y, bool IconSize, bool IconNight) {
   int scale = Large, linesize = 3;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y, scale, linesize);
   addsnow(x, y, scale, IconSize);
 }
 //#########################################################################################
-void Fog(int x, int y, bool IconSize, String IconName) {
+void Fog(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addcloud(x, y - 5, scale, linesize);
   addfog(x, y - 5, scale, linesize, IconSize);
 }
 //#########################################################################################
-void Haze(int x, int y, bool IconSize, String IconName) {
+void Haze(int x, int y, bool IconSize, bool IconNight) {
   int linesize = 3, scale = Large;
   if (IconSize == SmallIcon) {
     scale = Small;
     linesize = 1;
   }
-  if (IconName.endsWith("n")) addmoon(x, y, scale, IconSize);
+  if (IconNight) addmoon(x, y, scale, IconSize);
   addsun(x, y - 5, scale * 1.4, IconSize);
   addfog(x, y - 5, scale * 1.4, linesize, IconSize);
 }
@@ -842,7 +848,7 @@ void addmoon(int x, int y, int scale, bool IconSize) {
   }
 }
 //#########################################################################################
-void Nodata(int x, int y, bool IconSize, String IconName) {
+void Nodata(int x, int y, bool IconSize, bool IconNight) {
   if (IconSize == LargeIcon) u8g2Fonts.setFont(u8g2_font_helvB24_tf); else u8g2Fonts.setFont(u8g2_font_helvB10_tf);
   drawString(x - 3, y - 10, "?", CENTER);
   u8g2Fonts.setFont(u8g2_font_helvB08_tf);
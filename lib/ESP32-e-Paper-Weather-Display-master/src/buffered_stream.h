@@ -0,0 +1,96 @@
+#ifndef BUFFERED_STREAM_H_
+#define BUFFERED_STREAM_H_
+
+#include <Arduino.h>
+
+// Ring buffer size, a power of two. Each top up takes whatever has arrived, up to the free space
+#ifndef BUFFERED_STREAM_SIZE
+#define BUFFERED_STREAM_SIZE 2048
+#endif
+
+// Reads an HTTP body off the socket in chunks into a ring buffer, so a parser reading a byte at
+// a time gets it from RAM rather than from the client with its own timeout per call. The whole
+// read has one deadline: once the budget is spent the stream ends and the parser sees truncated
+// input. A source that goes quiet for its own timeout also ends the stream.
+class BufferedStream : public Stream {
+public:
+  BufferedStream(Stream& source, unsigned long budgetMs)
+    : source(source), budgetMs(budgetMs), start(millis()), head(0), tail(0), bytes(0), expired(false) {}
+
+  bool timedOut() const { return expired; }
+  uint32_t bytesRead() const { return bytes; }
+  unsigned long elapsedMs() const { return millis() - start; }
+  float bytesPerSecond() const { return elapsedMs() ? bytes * 1000.0 / elapsedMs() : 0; }
+  void printStats(const char* what) const {
+    Serial.printf("%s: %u bytes in %lu ms, %.1f KB/s%s\n", what, (unsigned)bytes, elapsedMs(), bytesPerSecond() / 1024,
+                  expired ? ", deadline reached" : "");
+  }
+
+  using Stream::readBytes;
+  int available() override {
+    topUp();
+    return tail - head;
+  }
+  int read() override {
+    if (!fill()) return -1;
+    return ring[head++ & (BUFFERED_STREAM_SIZE - 1)];
+  }
+  int peek() override {
+    if (!fill()) return -1;
+    return ring[head & (BUFFERED_STREAM_SIZE - 1)];
+  }
+  size_t readBytes(char* buffer, size_t length) override {
+    size_t count = 0;
+    while (count < length && fill()) {
+      size_t offset = head & (BUFFERED_STREAM_SIZE - 1);
+      size_t chunk  = min(length - count, min((size_t)(tail - head), BUFFERED_STREAM_SIZE - offset));
+      memcpy(buffer + count, ring + offset, chunk);
+      head  += chunk;
+      count += chunk;
+    }
+    return count;
+  }
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+private:
+  // Moves whatever the source already has into the free space, without waiting
+  void topUp() {
+    if (expired) return;
+    int waiting = source.available();
+    while (waiting > 0 && tail - head < BUFFERED_STREAM_SIZE) {
+      size_t offset = tail & (BUFFERED_STREAM_SIZE - 1);
+      size_t chunk  = min((size_t)waiting, min((size_t)(BUFFERED_STREAM_SIZE - (tail - head)), BUFFERED_STREAM_SIZE - offset));
+      size_t got    = source.readBytes((char*)ring + offset, chunk);
+      if (got == 0) break;
+      tail    += got;
+      bytes   += got;
+      waiting -= got;
+    }
+  }
+
+  // Waits until something is buffered, the source goes quiet or the deadline passes
+  bool fill() {
+    if (head != tail) return true;
+    unsigned long quietSince = millis();
+    while (!expired) {
+      topUp();
+      if (head != tail) return true;
+      if (millis() - start >= budgetMs) expired = true;
+      else if (millis() - quietSince >= source.getTimeout()) return false;
+      else delay(1);
+    }
+    return false;
+  }
+
+  Stream&       source;
+  unsigned long budgetMs;
+  unsigned long start;
+  uint32_t      head; // unread bytes are ring[head, tail), indices masked on use
+  uint32_t      tail;
+  uint32_t      bytes;
+  bool          expired;
+  uint8_t       ring[BUFFERED_STREAM_SIZE];
+};
+
+#endif /* ifndef BUFFERED_STREAM_H_ */
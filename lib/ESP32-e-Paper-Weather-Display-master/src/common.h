@@ -7,6 +7,8 @@
 
 #include "forecast_record.h"
 #include "common_functions.h"
+#include "buffered_stream.h"
+#include "gzipStream.h"
 
 //#########################################################################################
 void Convert_Readings_to_Imperial() {
@@ -17,12 +19,14 @@ void Convert_Readings_to_Imperial() {
 
 //#########################################################################################
 // Problems with stucturing JSON decodes, see here: https://arduinojson.org/assistant/
-bool DecodeWeather(WiFiClient& json, String Type) {
+bool DecodeWeather(Stream& json, String Type) {
   Serial.print(F("\nCreating object...and "));
   // allocate the JsonDocument
   DynamicJsonDocument doc(35 * 1024);
   // Deserialize the JSON document
+  unsigned long parseStart = millis();
   DeserializationError error = deserializeJson(doc, json);
+  Serial.printf("Parsed in %lu ms\n", millis() - parseStart);
   // Test if parsing succeeds.
   if (error) {
     Serial.print(F("deserializeJson() failed: "));
@@ -31,66 +35,71 @@ bool DecodeWeather(WiFiClient& json, String Type) {
   }
   // convert it to a JsonObject
   JsonObject root = doc.as<JsonObject>();
-  Serial.println(" Decoding " + Type + " data");
+  Serial.printf(" Decoding %s data\n", Type.c_str());
   if (Type == "weather") {
-    // All Serial.println statements are for diagnostic purposes and not required, remove if not needed
-    WxConditions[0].lon         = root["coord"]["lon"].as<float>();                    Serial.println(" Lon: "+String(WxConditions[0].lon));
-    WxConditions[0].lat         = root["coord"]["lat"].as<float>();                    Serial.println(" Lat: "+String(WxConditions[0].lat));
-    WxConditions[0].Main0       = root["weather"][0]["main"].as<const char*>();        Serial.println("Main: "+String(WxConditions[0].Main0));
-    WxConditions[0].Forecast0   = root["weather"][0]["description"].as<const char*>(); Serial.println("For0: "+String(WxConditions[0].Forecast0));
-    WxConditions[0].Forecast1   = root["weather"][1]["description"].as<const char*>(); Serial.println("For1: "+String(WxConditions[0].Forecast1));
-    WxConditions[0].Forecast2   = root["weather"][2]["description"].as<const char*>(); Serial.println("For2: "+String(WxConditions[0].Forecast2));
-    WxConditions[0].Icon        = root["weather"][0]["icon"].as<const char*>();        Serial.println("Icon: "+String(WxConditions[0].Icon));
-    WxConditions[0].Temperature = root["main"]["temp"].as<float>();                    Serial.println("Temp: "+String(WxConditions[0].Temperature));
-    WxConditions[0].Pressure    = root["main"]["pressure"].as<float>();                Serial.println("Pres: "+String(WxConditions[0].Pressure));
-    WxConditions[0].Humidity    = root["main"]["humidity"].as<float>();                Serial.println("Humi: "+String(WxConditions[0].Humidity));
-    WxConditions[0].Low         = root["main"]["temp_min"].as<float>();                Serial.println("TLow: "+String(WxConditions[0].Low));
-    WxConditions[0].High        = root["main"]["temp_max"].as<float>();                Serial.println("THig: "+String(WxConditions[0].High));
-    WxConditions[0].Windspeed   = root["wind"]["speed"].as<float>();                   Serial.println("WSpd: "+String(WxConditions[0].Windspeed));
-    WxConditions[0].Winddir     = root["wind"]["deg"].as<float>();                     Serial.println("WDir: "+String(WxConditions[0].Winddir));
-    WxConditions[0].Cloudcover  = root["clouds"]["all"].as<int>();                     Serial.println("CCov: "+String(WxConditions[0].Cloudcover)); // in % of cloud cover
-    WxConditions[0].Visibility  = root["visibility"].as<int>();                        Serial.println("Visi: "+String(WxConditions[0].Visibility)); // in metres
-    WxConditions[0].Rainfall    = root["rain"]["1h"].as<float>();                      Serial.println("Rain: "+String(WxConditions[0].Rainfall));
-    WxConditions[0].Snowfall    = root["snow"]["1h"].as<float>();                      Serial.println("Snow: "+String(WxConditions[0].Snowfall));
-    WxConditions[0].Country     = root["sys"]["country"].as<const char*>();            Serial.println("Ctry: "+String(WxConditions[0].Country));
-    WxConditions[0].Sunrise     = root["sys"]["sunrise"].as<int>();                    Serial.println("SRis: "+String(WxConditions[0].Sunrise));
-    WxConditions[0].Sunset      = root["sys"]["sunset"].as<int>();                     Serial.println("SSet: "+String(WxConditions[0].Sunset));
-    WxConditions[0].Timezone    = root["timezone"].as<int>();                          Serial.println("TZon: "+String(WxConditions[0].Timezone));  }
+    // All Serial.printf statements are for diagnostic purposes and not required, remove if not needed
+    WxConditions[0].lon         = root["coord"]["lon"].as<float>();                    Serial.printf(" Lon: %.2f\n", WxConditions[0].lon);
+    WxConditions[0].lat         = root["coord"]["lat"].as<float>();                    Serial.printf(" Lat: %.2f\n", WxConditions[0].lat);
+    CopyField(WxConditions[0].Main0,      root["weather"][0]["main"].as<const char*>());        Serial.printf("Main: %s\n", WxConditions[0].Main0);
+    CopyField(WxConditions[0].Forecast0,  root["weather"][0]["description"].as<const char*>()); Serial.printf("For0: %s\n", WxConditions[0].Forecast0);
+    CopyField(WxConditions[0].Forecast1,  root["weather"][1]["description"].as<const char*>()); Serial.printf("For1: %s\n", WxConditions[0].Forecast1);
+    CopyField(WxConditions[0].Forecast2,  root["weather"][2]["description"].as<const char*>()); Serial.printf("For2: %s\n", WxConditions[0].Forecast2);
+    CopyField(WxConditions[0].Icon,       root["weather"][0]["icon"].as<const char*>());        Serial.printf("Icon: %s\n", WxConditions[0].Icon);
+    WxConditions[0].IconCode    = DecodeIconCode(WxConditions[0].Icon);
+    WxConditions[0].Temperature = root["main"]["temp"].as<float>();                    Serial.printf("Temp: %.2f\n", WxConditions[0].Temperature);
+    WxConditions[0].Pressure    = root["main"]["pressure"].as<float>();                Serial.printf("Pres: %.2f\n", WxConditions[0].Pressure);
+    WxConditions[0].Humidity    = root["main"]["humidity"].as<float>();                Serial.printf("Humi: %.2f\n", WxConditions[0].Humidity);
+    WxConditions[0].Low         = root["main"]["temp_min"].as<float>();                Serial.printf("TLow: %.2f\n", WxConditions[0].Low);
+    WxConditions[0].High        = root["main"]["temp_max"].as<float>();                Serial.printf("THig: %.2f\n", WxConditions[0].High);
+    WxConditions[0].Windspeed   = root["wind"]["speed"].as<float>();                   Serial.printf("WSpd: %.2f\n", WxConditions[0].Windspeed);
+    WxConditions[0].Winddir     = root["wind"]["deg"].as<float>();                     Serial.printf("WDir: %.2f\n", WxConditions[0].Winddir);
+    WxConditions[0].Cloudcover  = root["clouds"]["all"].as<int>();                     Serial.printf("CCov: %d\n", WxConditions[0].Cloudcover); // in % of cloud cover
+    WxConditions[0].Visibility  = root["visibility"].as<int>();                        Serial.printf("Visi: %d\n", WxConditions[0].Visibility); // in metres
+    WxConditions[0].Rainfall    = root["rain"]["1h"].as<float>();                      Serial.printf("Rain: %.2f\n", WxConditions[0].Rainfall);
+    WxConditions[0].Snowfall    = root["snow"]["1h"].as<float>();                      Serial.printf("Snow: %.2f\n", WxConditions[0].Snowfall);
+    CopyField(WxConditions[0].Country,    root["sys"]["country"].as<const char*>());            Serial.printf("Ctry: %s\n", WxConditions[0].Country);
+    WxConditions[0].Sunrise     = root["sys"]["sunrise"].as<int>();                    Serial.printf("SRis: %d\n", WxConditions[0].Sunrise);
+    WxConditions[0].Sunset      = root["sys"]["sunset"].as<int>();                     Serial.printf("SSet: %d\n", WxConditions[0].Sunset);
+    WxConditions[0].Timezone    = root["timezone"].as<int>();                          Serial.printf("TZon: %d\n", WxConditions[0].Timezone);  }
   if (Type == "forecast") {
     //Serial.println(json);
     Serial.print(F("\nReceiving Forecast period - ")); //------------------------------------------------
     JsonArray list                    = root["list"];
-    for (byte r = 0; r < max_readings; r++) {
-      Serial.println("\nPeriod-" + String(r) + "--------------");
-      WxForecast[r].Dt                = list[r]["dt"].as<int>();                                Serial.println("DTim: "+String(WxForecast[r].Dt));
-      WxForecast[r].Temperature       = list[r]["main"]["temp"].as<float>();                    Serial.println("Temp: "+String(WxForecast[r].Temperature));
-      WxForecast[r].Low               = list[r]["main"]["temp_min"].as<float>();                Serial.println("TLow: "+String(WxForecast[r].Low));
-      WxForecast[r].High              = list[r]["main"]["temp_max"].as<float>();                Serial.println("THig: "+String(WxForecast[r].High));
-      WxForecast[r].Pressure          = list[r]["main"]["pressure"].as<float>();                Serial.println("Pres: "+String(WxForecast[r].Pressure));
-      WxForecast[r].Humidity          = list[r]["main"]["humidity"].as<float>();                Serial.println("Humi: "+String(WxForecast[r].Humidity));
-      WxForecast[r].Forecast0         = list[r]["weather"][0]["main"].as<const char*>();        Serial.println("For0: "+String(WxForecast[r].Forecast0));
-      WxForecast[r].Forecast1         = list[r]["weather"][1]["main"].as<const char*>();        Serial.println("For1: "+String(WxForecast[r].Forecast1));
-      WxForecast[r].Forecast2         = list[r]["weather"][2]["main"].as<const char*>();        Serial.println("For2: "+String(WxForecast[r].Forecast2));
-      WxForecast[r].Icon              = list[r]["weather"][0]["icon"].as<const char*>();        Serial.println("Icon: "+String(WxForecast[r].Icon));
-      WxForecast[r].Description       = list[r]["weather"][0]["description"].as<const char*>(); Serial.println("Desc: "+String(WxForecast[r].Description));
-      WxForecast[r].Cloudcover        = list[r]["clouds"]["all"].as<int>();                     Serial.println("CCov: "+String(WxForecast[r].Cloudcover)); // in % of cloud cover
-      WxForecast[r].Windspeed         = list[r]["wind"]["speed"].as<float>();                   Serial.println("WSpd: "+String(WxForecast[r].Windspeed));
-      WxForecast[r].Winddir           = list[r]["wind"]["deg"].as<float>();                     Serial.println("WDir: "+String(WxForecast[r].Winddir));
-      WxForecast[r].Rainfall          = list[r]["rain"]["3h"].as<float>();                      Serial.println("Rain: "+String(WxForecast[r].Rainfall));
-      WxForecast[r].Snowfall          = list[r]["snow"]["3h"].as<float>();                      Serial.println("Snow: "+String(WxForecast[r].Snowfall));
-      WxForecast[r].Pop               = list[r]["pop"].as<float>();                             Serial.println("Pop:  "+String(WxForecast[r].Pop));
-      WxForecast[r].Period            = list[r]["dt_txt"].as<const char*>();                    Serial.println("Peri: "+String(WxForecast[r].Period));
+    // OWM may send fewer periods than asked for; the rest are left as they were (zero after boot)
+    byte readings                     = min((size_t)max_readings, list.size());
+    for (byte r = 0; r < readings; r++) {
+      Serial.printf("\nPeriod-%d--------------\n", r);
+      WxForecast[r].Dt                = list[r]["dt"].as<int>();                                Serial.printf("DTim: %d\n", WxForecast[r].Dt);
+      WxForecast[r].Temperature       = list[r]["main"]["temp"].as<float>();                    Serial.printf("Temp: %.2f\n", WxForecast[r].Temperature);
+      WxForecast[r].Low               = list[r]["main"]["temp_min"].as<float>();                Serial.printf("TLow: %.2f\n", WxForecast[r].Low);
+      WxForecast[r].High              = list[r]["main"]["temp_max"].as<float>();                Serial.printf("THig: %.2f\n", WxForecast[r].High);
+      WxForecast[r].Pressure          = list[r]["main"]["pressure"].as<float>();                Serial.printf("Pres: %.2f\n", WxForecast[r].Pressure);
+      WxForecast[r].Humidity          = list[r]["main"]["humidity"].as<float>();                Serial.printf("Humi: %.2f\n", WxForecast[r].Humidity);
+      CopyField(WxForecast[r].Forecast0,        list[r]["weather"][0]["main"].as<const char*>());        Serial.printf("For0: %s\n", WxForecast[r].Forecast0);
+      CopyField(WxForecast[r].Forecast1,        list[r]["weather"][1]["main"].as<const char*>());        Serial.printf("For1: %s\n", WxForecast[r].Forecast1);
+      CopyField(WxForecast[r].Forecast2,        list[r]["weather"][2]["main"].as<const char*>());        Serial.printf("For2: %s\n", WxForecast[r].Forecast2);
+      CopyField(WxForecast[r].Icon,             list[r]["weather"][0]["icon"].as<const char*>());        Serial.printf("Icon: %s\n", WxForecast[r].Icon);
+      WxForecast[r].IconCode          = DecodeIconCode(WxForecast[r].Icon);
+      CopyField(WxForecast[r].Description,      list[r]["weather"][0]["description"].as<const char*>()); Serial.printf("Desc: %s\n", WxForecast[r].Description);
+      WxForecast[r].Cloudcover        = list[r]["clouds"]["all"].as<int>();                     Serial.printf("CCov: %d\n", WxForecast[r].Cloudcover); // in % of cloud cover
+      WxForecast[r].Windspeed         = list[r]["wind"]["speed"].as<float>();                   Serial.printf("WSpd: %.2f\n", WxForecast[r].Windspeed);
+      WxForecast[r].Winddir           = list[r]["wind"]["deg"].as<float>();                     Serial.printf("WDir: %.2f\n", WxForecast[r].Winddir);
+      WxForecast[r].Rainfall          = list[r]["rain"]["3h"].as<float>();                      Serial.printf("Rain: %.2f\n", WxForecast[r].Rainfall);
+      WxForecast[r].Snowfall          = list[r]["snow"]["3h"].as<float>();                      Serial.printf("Snow: %.2f\n", WxForecast[r].Snowfall);
+      WxForecast[r].Pop               = list[r]["pop"].as<float>();                             Serial.printf("Pop:  %.2f\n", WxForecast[r].Pop);
+      CopyField(WxForecast[r].Period,           list[r]["dt_txt"].as<const char*>());                    Serial.printf("Peri: %s\n", WxForecast[r].Period);
     }
     //------------------------------------------
     float pressure_trend = WxForecast[2].Pressure - WxForecast[0].Pressure; // Measure pressure slope between ~now and later
     pressure_trend = ((int)(pressure_trend * 10)) / 10.0; // Remove any small variations less than 0.1
-    WxConditions[0].Trend = "0";
-    if (pressure_trend > 0)  WxConditions[0].Trend = "+";
-    if (pressure_trend < 0)  WxConditions[0].Trend = "-";
-    if (pressure_trend == 0) WxConditions[0].Trend = "0";
+    CopyField(WxConditions[0].Trend, "0");
+    if (pressure_trend > 0)  CopyField(WxConditions[0].Trend, "+");
+    if (pressure_trend < 0)  CopyField(WxConditions[0].Trend, "-");
+    if (pressure_trend == 0) CopyField(WxConditions[0].Trend, "0");
 
     if (Units == "I") Convert_Readings_to_Imperial();
   }
+  Serial.printf("Heap free: %u, low water: %u\n", (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap());
   return true;
 }
 //#########################################################################################
@@ -121,9 +130,22 @@ bool obtain_wx_data(WiFiClient& client, const String& RequestType) {
   }
   //http.begin(uri,test_root_ca); //HTTPS example connection
   http.begin(client, server, 80, uri);
+  const char* responseHeaders[] = {"Content-Encoding"};
+  http.collectHeaders(responseHeaders, 1);
+  http.addHeader("Accept-Encoding", "gzip"); // OWM's JSON compresses to about a fifth
   int httpCode = http.GET();
   if(httpCode == HTTP_CODE_OK) {
-    if (!DecodeWeather(http.getStream(), RequestType)) return false;
+    BufferedStream body(http.getStream(), 15000); // the whole response within 15 s
+    bool decoded;
+    if (http.header("Content-Encoding") == "gzip") {
+      GzipStream inflated(body); // inflates from the buffer, so the deadline still covers the socket
+      decoded = inflated.begin() && DecodeWeather(inflated, RequestType);
+      Serial.printf("%s: %u bytes inflated\n", RequestType.c_str(), (unsigned)inflated.inflatedBytes());
+    }
+    else
+      decoded = DecodeWeather(body, RequestType);
+    body.printStats(RequestType.c_str());
+    if (!decoded) return false;
     client.stop();
     http.end();
     return true;
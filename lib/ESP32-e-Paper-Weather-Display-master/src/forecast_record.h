@@ -3,18 +3,31 @@
 
 #include <Arduino.h>
 
+// OWM icon codes ("01d" .. "50n") decoded once at parse time, so drawing code can
+// dispatch on a number instead of comparing strings
+enum IconKind : uint8_t {
+  ICON_NONE,             // unknown or missing icon
+  ICON_CLEAR,            // 01
+  ICON_FEW_CLOUDS,       // 02
+  ICON_SCATTERED_CLOUDS, // 03
+  ICON_BROKEN_CLOUDS,    // 04
+  ICON_SHOWER_RAIN,      // 09
+  ICON_RAIN,             // 10
+  ICON_THUNDERSTORM,     // 11
+  ICON_SNOW,             // 13
+  ICON_MIST,             // 50
+  ICON_KINDS
+};
+const uint8_t ICON_NIGHT     = 0x80; // set for the "n" variants
+const uint8_t ICON_KIND_MASK = 0x7F;
+
+// Text fields are fixed size so the records are one contiguous, allocation free block.
+// Sizes fit the longest values OWM sends, with room for translated descriptions.
 typedef struct { // For current Day and Day 1, 2, 3, etc
   int      Dt;
-  String   Period;
-  String   Icon;
-  String   Trend;
-  String   Main0;
-  String   Forecast0;
-  String   Forecast1;
-  String   Forecast2;
-  String   Description;
-  String   Time;
-  String   Country;
+  int      Sunrise;
+  int      Sunset;
+  int      Timezone;
   float    lat;
   float    lon;
   float    Temperature;
@@ -28,11 +41,50 @@ typedef struct { // For current Day and Day 1, 2, 3, etc
   float    Snowfall;
   float    Pop;
   float    Pressure;
-  int      Cloudcover;
-  int      Visibility;
-  int      Sunrise;
-  int      Sunset;
-  int      Timezone;
+  uint16_t Visibility;   // metres, OWM caps it at 10000
+  uint8_t  Cloudcover;   // percent
+  uint8_t  IconCode;     // IconKind, or'ed with ICON_NIGHT
+  char     Icon[4];      // e.g. "01d"
+  char     Trend[2];     // "+", "-" or "0"
+  char     Country[3];   // ISO 3166 code
+  char     Period[20];   // "2023-01-01 12:00:00"
+  char     Main0[16];
+  char     Forecast0[40];
+  char     Forecast1[40];
+  char     Forecast2[40];
+  char     Description[40];
+  char     Time[8];
 } Forecast_record_type;
 
+// Copies a possibly NULL string into a fixed size record field, truncating if needed. A cut never
+// splits a UTF-8 character, so descriptions in lang=fr, gr and the like stay printable
+template <size_t N>
+void CopyField(char (&field)[N], const char *value) {
+  if (value == NULL) value = "";
+  size_t length = strlcpy(field, value, N);
+  if (length < N) return;
+  size_t cut = N - 1;
+  while (cut > 0 && (value[cut] & 0xC0) == 0x80) cut--; // back to the first byte of the character cut through
+  field[cut] = '\0';
+}
+
+// Maps an OWM icon name such as "10n" to an IconKind plus the ICON_NIGHT bit
+inline uint8_t DecodeIconCode(const char *icon) {
+  if (icon == NULL || icon[0] < '0' || icon[0] > '9' || icon[1] < '0' || icon[1] > '9') return ICON_NONE;
+  uint8_t kind;
+  switch ((icon[0] - '0') * 10 + (icon[1] - '0')) {
+    case 1:  kind = ICON_CLEAR;            break;
+    case 2:  kind = ICON_FEW_CLOUDS;       break;
+    case 3:  kind = ICON_SCATTERED_CLOUDS; break;
+    case 4:  kind = ICON_BROKEN_CLOUDS;    break;
+    case 9:  kind = ICON_SHOWER_RAIN;      break;
+    case 10: kind = ICON_RAIN;             break;
+    case 11: kind = ICON_THUNDERSTORM;     break;
+    case 13: kind = ICON_SNOW;             break;
+    case 50: kind = ICON_MIST;             break;
+    default: return ICON_NONE;
+  }
+  return icon[2] == 'n' ? (kind | ICON_NIGHT) : kind;
+}
+
 #endif /* ifndef FORECAST_RECORD_H_ */
@@ -0,0 +1,158 @@
+#include <Arduino.h>
+#include "gzipStream.h"
+#include <esp32/rom/miniz.h> // the inflater in the ESP32 mask ROM, costs no flash
+
+static const size_t WindowSize = 1 << GZIP_WINDOW_BITS;
+
+// gzip header flags, RFC 1952
+static const uint8_t GZIP_FHCRC = 0x02;
+static const uint8_t GZIP_FEXTRA = 0x04;
+static const uint8_t GZIP_FNAME = 0x08;
+static const uint8_t GZIP_FCOMMENT = 0x10;
+
+GzipStream::GzipStream(Stream &source)
+  : source(source), inflater(NULL), window(NULL), windowPos(0), outStart(0), outEnd(0),
+    inputStart(0), inputEnd(0), finished(false), error(false), bytesIn(0), bytesOut(0) {}
+
+GzipStream::~GzipStream() {
+  free(inflater);
+  free(window);
+}
+
+bool GzipStream::begin() {
+  if (!skipHeader()) {
+    Serial.println("gzip: bad header");
+    error = true;
+    return false;
+  }
+
+  inflater = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+  window = (uint8_t *)malloc(WindowSize);
+  if (inflater == NULL || window == NULL) {
+    Serial.println("gzip: out of memory");
+    error = true;
+    return false;
+  }
+  tinfl_init(inflater);
+  return true;
+}
+
+// Blocks for up to the source's timeout, like Stream::timedRead
+int GzipStream::readSourceByte() {
+  unsigned long start = millis();
+  do {
+    int c = source.read();
+    if (c >= 0) {
+      bytesIn++;
+      return c;
+    }
+    delay(1);
+  } while (millis() - start < source.getTimeout());
+  return -1;
+}
+
+bool GzipStream::skipHeader() {
+  if (readSourceByte() != 0x1f || readSourceByte() != 0x8b || readSourceByte() != 8) // magic, deflate
+    return false;
+  int flags = readSourceByte();
+  if (flags < 0)
+    return false;
+  for (int i = 0; i < 6; i++) { // mtime, extra flags, OS
+    if (readSourceByte() < 0)
+      return false;
+  }
+  if (flags & GZIP_FEXTRA) {
+    int low = readSourceByte();
+    int high = readSourceByte();
+    if (low < 0 || high < 0)
+      return false;
+    for (int length = low | (high << 8); length > 0; length--) {
+      if (readSourceByte() < 0)
+        return false;
+    }
+  }
+  for (uint8_t zeroTerminated : {GZIP_FNAME, GZIP_FCOMMENT}) {
+    if (flags & zeroTerminated) {
+      int c;
+      do {
+        c = readSourceByte();
+      } while (c > 0);
+      if (c < 0)
+        return false;
+    }
+  }
+  if (flags & GZIP_FHCRC) {
+    if (readSourceByte() < 0 || readSourceByte() < 0)
+      return false;
+  }
+  return true;
+}
+
+// Inflates until there is output to hand out, or the stream ends. The deflate data marks its own
+// end, so the trailing CRC and length are never waited for; the JSON parser checks the content.
+bool GzipStream::fill() {
+  while (outStart == outEnd && !finished) {
+    if (inputStart == inputEnd) {
+      int c = readSourceByte(); // wait for at least one byte, then take whatever has arrived
+      if (c < 0) {
+        Serial.println("gzip: stream truncated");
+        error = finished = true;
+        break;
+      }
+      input[0] = c;
+      int waiting = source.available();
+      size_t more = waiting > 0 ? min((size_t)waiting, sizeof(input) - 1) : 0;
+      more = source.readBytes(input + 1, more);
+      bytesIn += more;
+      inputStart = 0;
+      inputEnd = 1 + more;
+    }
+
+    size_t inSize = inputEnd - inputStart;
+    size_t outSize = WindowSize - windowPos;
+    tinfl_status status = tinfl_decompress(inflater, input + inputStart, &inSize, window, window + windowPos, &outSize,
+                                           TINFL_FLAG_HAS_MORE_INPUT);
+    inputStart += inSize;
+    outStart = windowPos;
+    outEnd = windowPos + outSize;
+    windowPos = (windowPos + outSize) & (WindowSize - 1);
+    bytesOut += outSize;
+
+    if (status == TINFL_STATUS_DONE)
+      finished = true;
+    else if (status < TINFL_STATUS_DONE) {
+      Serial.printf("gzip: inflate failed (%d)\n", status);
+      error = finished = true;
+    }
+  }
+  return outStart != outEnd;
+}
+
+int GzipStream::available() {
+  if (outStart == outEnd && !finished)
+    fill();
+  return outEnd - outStart;
+}
+
+int GzipStream::read() {
+  if (!fill())
+    return -1;
+  return window[outStart++];
+}
+
+int GzipStream::peek() {
+  if (!fill())
+    return -1;
+  return window[outStart];
+}
+
+size_t GzipStream::readBytes(char *buffer, size_t length) {
+  size_t count = 0;
+  while (count < length && fill()) {
+    size_t chunk = min(length - count, outEnd - outStart);
+    memcpy(buffer + count, window + outStart, chunk);
+    outStart += chunk;
+    count += chunk;
+  }
+  return count;
+}
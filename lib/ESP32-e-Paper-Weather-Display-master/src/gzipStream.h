@@ -0,0 +1,54 @@
+#ifndef GZIP_STREAM_H_
+#define GZIP_STREAM_H_
+
+#include <Arduino.h>
+
+// Window the inflater keeps, as log2 bytes. Deflate streams may refer back up to 32 KB, which is
+// what zlib and most servers use, so only lower this for a server known to compress with a smaller
+// window (the stand-in server's --window-bits)
+#ifndef GZIP_WINDOW_BITS
+#define GZIP_WINDOW_BITS 15
+#endif
+
+// Reads a gzip response body from 'source' and hands out the inflated bytes, so the JSON parser
+// can consume it incrementally. Memory is the window plus the inflater state, allocated in begin()
+// and released by the destructor, never the whole document.
+class GzipStream : public Stream {
+public:
+  explicit GzipStream(Stream &source);
+  ~GzipStream();
+
+  bool begin(); // reads the gzip header and allocates the window; false if either fails
+  bool failed() const { return error; }
+  uint32_t compressedBytes() const { return bytesIn; }
+  uint32_t inflatedBytes() const { return bytesOut; }
+
+  using Stream::readBytes;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+private:
+  bool fill();
+  int readSourceByte();
+  bool skipHeader();
+
+  Stream &source;
+  struct tinfl_decompressor_tag *inflater;
+  uint8_t *window;        // inflated output, also the back-reference dictionary
+  size_t windowPos;       // where the inflater writes next
+  size_t outStart;        // unread inflated bytes are window[outStart, outEnd)
+  size_t outEnd;
+  uint8_t input[256];
+  size_t inputStart;
+  size_t inputEnd;
+  bool finished;
+  bool error;
+  uint32_t bytesIn;
+  uint32_t bytesOut;
+};
+
+#endif /* ifndef GZIP_STREAM_H_ */
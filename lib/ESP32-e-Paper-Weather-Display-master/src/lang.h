@@ -1,68 +1,71 @@
 #define FONT(x) x##_tf
+// Strings are plain char arrays so they live in flash and need no constructors at boot.
+// Pick a language by including its header; on ESP32 flash is memory mapped, so the
+// arrays can be passed wherever a const char* or String is expected.
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "3-Day Forecast Values";
-const String TXT_CONDITIONS       = "Conditions";
-const String TXT_DAYS             = "(Days)";
-const String TXT_TEMPERATURES     = "Temperature";
-const String TXT_TEMPERATURE_C    = "Temperature (*C)";
-const String TXT_TEMPERATURE_F    = "Temperature (*F)";
-const String TXT_HUMIDITY_PERCENT = "Humidity (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "3-Day Forecast Values";
+const char TXT_CONDITIONS[] PROGMEM       = "Conditions";
+const char TXT_DAYS[] PROGMEM             = "(Days)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperature";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperature (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperature (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Humidity (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Pressure";
-const String TXT_PRESSURE_HPA     = "Pressure (hPa)";
-const String TXT_PRESSURE_IN      = "Pressure (in)";
-const String TXT_PRESSURE_STEADY  = "Steady";
-const String TXT_PRESSURE_RISING  = "Rising";
-const String TXT_PRESSURE_FALLING = "Falling";
+const char TXT_PRESSURE[] PROGMEM         = "Pressure";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Pressure (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Pressure (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Steady";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Rising";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Falling";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Rainfall (mm)";
-const String TXT_RAINFALL_IN = "Rainfall (in)";
-const String TXT_SNOWFALL_MM = "Snowfall (mm)";
-const String TXT_SNOWFALL_IN = "Snowfall (in)";
-const String TXT_PRECIPITATION_SOON = "Prec.";
+const char TXT_RAINFALL_MM[] PROGMEM = "Rainfall (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Rainfall (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Snowfall (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Snowfall (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Prec.";
 
 
 //Sun
-const String TXT_SUNRISE  = "Sunrise";
-const String TXT_SUNSET   = "Sunset";
+const char TXT_SUNRISE[] PROGMEM  = "Sunrise";
+const char TXT_SUNSET[] PROGMEM   = "Sunset";
 
 //Moon
-const String TXT_MOON_NEW             = "New";
-const String TXT_MOON_WAXING_CRESCENT = "Waxing Crescent";
-const String TXT_MOON_FIRST_QUARTER   = "First Quarter";
-const String TXT_MOON_WAXING_GIBBOUS  = "Waxing Gibbous";
-const String TXT_MOON_FULL            = "Full";
-const String TXT_MOON_WANING_GIBBOUS  = "Waning Gibbous";
-const String TXT_MOON_THIRD_QUARTER   = "Third Quarter";
-const String TXT_MOON_WANING_CRESCENT = "Waning Crescent";
+const char TXT_MOON_NEW[] PROGMEM             = "New";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Waxing Crescent";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "First Quarter";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Waxing Gibbous";
+const char TXT_MOON_FULL[] PROGMEM            = "Full";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Waning Gibbous";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Third Quarter";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Waning Crescent";
 
 //Power / WiFi
-const String TXT_POWER  = "Power";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Updated:";
+const char TXT_POWER[] PROGMEM  = "Power";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Updated:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Wind Speed/Direction";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE  = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E   = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE  = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSW";
-const String TXT_SW  = "SW";
-const String TXT_WSW = "WSW";
-const String TXT_W   = "W";
-const String TXT_WNW = "WNW";
-const String TXT_NW  = "NW";
-const String TXT_NNW = "NNW";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Wind Speed/Direction";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM  = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM   = "E";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM  = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSW";
+const char TXT_SW[] PROGMEM  = "SW";
+const char TXT_WSW[] PROGMEM = "WSW";
+const char TXT_W[] PROGMEM   = "W";
+const char TXT_WNW[] PROGMEM = "WNW";
+const char TXT_NW[] PROGMEM  = "NW";
+const char TXT_NNW[] PROGMEM = "NNW";
 
 //Day of the week
 const char* weekday_D[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
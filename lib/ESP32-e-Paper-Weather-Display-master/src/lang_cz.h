@@ -1,67 +1,67 @@
 #define FONT(x) x##_te
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "3-denní předpověd";
-const String TXT_CONDITIONS       = "Situace";
-const String TXT_DAYS             = "(Dny)";
-const String TXT_TEMPERATURES     = "Teplota";
-const String TXT_TEMPERATURE_C    = "Teplota (*C)";
-const String TXT_TEMPERATURE_F    = "Teplota (*F)";
-const String TXT_HUMIDITY_PERCENT = "Vlhkost (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "3-denní předpověd";
+const char TXT_CONDITIONS[] PROGMEM       = "Situace";
+const char TXT_DAYS[] PROGMEM             = "(Dny)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Teplota";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Teplota (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Teplota (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Vlhkost (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Tlak";
-const String TXT_PRESSURE_HPA     = "Tlak (hPa)";
-const String TXT_PRESSURE_IN      = "Tlak (in)";
-const String TXT_PRESSURE_STEADY  = "Konstantní";
-const String TXT_PRESSURE_RISING  = "Stoupající";
-const String TXT_PRESSURE_FALLING = "Klesající";
+const char TXT_PRESSURE[] PROGMEM         = "Tlak";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Tlak (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Tlak (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Konstantní";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Stoupající";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Klesající";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Srážky (mm)";
-const String TXT_RAINFALL_IN = "Srážky (in)";
-const String TXT_SNOWFALL_MM = "Sněžení (mm)";
-const String TXT_SNOWFALL_IN = "Sněžení (in)";
-const String TXT_PRECIPITATION_SOON = "Srážky";
+const char TXT_RAINFALL_MM[] PROGMEM = "Srážky (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Srážky (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Sněžení (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Sněžení (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Srážky";
 
 //Sun
-const String TXT_SUNRISE  = "Východ slunce";
-const String TXT_SUNSET   = "Západ slunce";
+const char TXT_SUNRISE[] PROGMEM  = "Východ slunce";
+const char TXT_SUNSET[] PROGMEM   = "Západ slunce";
 
 //Moon
-const String TXT_MOON_NEW             = "Nov";
-const String TXT_MOON_WAXING_CRESCENT = "Dorůst. srpek";
-const String TXT_MOON_FIRST_QUARTER   = "První čtvrt";
-const String TXT_MOON_WAXING_GIBBOUS  = "Dorůst. měsíc";
-const String TXT_MOON_FULL            = "Úplněk";
-const String TXT_MOON_WANING_GIBBOUS  = "Couvající měsíc";
-const String TXT_MOON_THIRD_QUARTER   = "Poslední čtvrt";
-const String TXT_MOON_WANING_CRESCENT = "Ubývající srpek";
+const char TXT_MOON_NEW[] PROGMEM             = "Nov";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Dorůst. srpek";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "První čtvrt";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Dorůst. měsíc";
+const char TXT_MOON_FULL[] PROGMEM            = "Úplněk";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Couvající měsíc";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Poslední čtvrt";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Ubývající srpek";
 
 //Power / WiFi
-const String TXT_POWER  = "Síla";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Aktual.:";
+const char TXT_POWER[] PROGMEM  = "Síla";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Aktual.:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Rýchl. větra/směr";
-const String TXT_N   = "S";
-const String TXT_NNE = "SSV";
-const String TXT_NE  = "SV";
-const String TXT_ENE = "VSV";
-const String TXT_E   = "V";
-const String TXT_ESE = "VJV";
-const String TXT_SE  = "JV";
-const String TXT_SSE = "JJV";
-const String TXT_S   = "J";
-const String TXT_SSW = "JJZ";
-const String TXT_SW  = "JZ";
-const String TXT_WSW = "ZJZ";
-const String TXT_W   = "Z";
-const String TXT_WNW = "ZSZ";
-const String TXT_NW  = "SZ";
-const String TXT_NNW = "SSZ";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Rýchl. větra/směr";
+const char TXT_N[] PROGMEM   = "S";
+const char TXT_NNE[] PROGMEM = "SSV";
+const char TXT_NE[] PROGMEM  = "SV";
+const char TXT_ENE[] PROGMEM = "VSV";
+const char TXT_E[] PROGMEM   = "V";
+const char TXT_ESE[] PROGMEM = "VJV";
+const char TXT_SE[] PROGMEM  = "JV";
+const char TXT_SSE[] PROGMEM = "JJV";
+const char TXT_S[] PROGMEM   = "J";
+const char TXT_SSW[] PROGMEM = "JJZ";
+const char TXT_SW[] PROGMEM  = "JZ";
+const char TXT_WSW[] PROGMEM = "ZJZ";
+const char TXT_W[] PROGMEM   = "Z";
+const char TXT_WNW[] PROGMEM = "ZSZ";
+const char TXT_NW[] PROGMEM  = "SZ";
+const char TXT_NNW[] PROGMEM = "SSZ";
 
 //Day of the week
 const char* weekday_D[] = { "Ned", "Pon", "Úte", "Stř", "Čtv", "Pát", "Sob" };
@@ -1,68 +1,68 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "Previsión 3 días";
-const String TXT_CONDITIONS       = "Condiciones";
-const String TXT_DAYS             = "(Días)";
-const String TXT_TEMPERATURES     = "Temperatura";
-const String TXT_TEMPERATURE_C    = "Temperatura (*C)";
-const String TXT_TEMPERATURE_F    = "Temperatura (*F)";
-const String TXT_HUMIDITY_PERCENT = "Humedad (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "Previsión 3 días";
+const char TXT_CONDITIONS[] PROGMEM       = "Condiciones";
+const char TXT_DAYS[] PROGMEM             = "(Días)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatura";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatura (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatura (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Humedad (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Presión";
-const String TXT_PRESSURE_HPA     = "Presión (hPa)";
-const String TXT_PRESSURE_IN      = "Presión (in)";
-const String TXT_PRESSURE_STEADY  = "Estable";
-const String TXT_PRESSURE_RISING  = "Subiendo";
-const String TXT_PRESSURE_FALLING = "Bajando";
+const char TXT_PRESSURE[] PROGMEM         = "Presión";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Presión (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Presión (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Estable";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Subiendo";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Bajando";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Lluvia (mm)";
-const String TXT_RAINFALL_IN = "Lluvia (in)";
-const String TXT_SNOWFALL_MM = "Nieve (mm)";
-const String TXT_SNOWFALL_IN = "Nieve (in)";
-const String TXT_PRECIPITATION_SOON = "Prec.";
+const char TXT_RAINFALL_MM[] PROGMEM = "Lluvia (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Lluvia (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Nieve (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Nieve (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Prec.";
 
 
 //Sun
-const String TXT_SUNRISE  = "Amanecer";
-const String TXT_SUNSET   = "Ocaso";
+const char TXT_SUNRISE[] PROGMEM  = "Amanecer";
+const char TXT_SUNSET[] PROGMEM   = "Ocaso";
 
 //Moon
-const String TXT_MOON_NEW             = "Nueva";
-const String TXT_MOON_WAXING_CRESCENT = "Creciente";
-const String TXT_MOON_FIRST_QUARTER   = "Cuarto creciente";
-const String TXT_MOON_WAXING_GIBBOUS  = "Creciente gibosa";
-const String TXT_MOON_FULL            = "Llena";
-const String TXT_MOON_WANING_GIBBOUS  = "Menguante gibosa";
-const String TXT_MOON_THIRD_QUARTER   = "Cuarto menguante";
-const String TXT_MOON_WANING_CRESCENT = "Menguante";
+const char TXT_MOON_NEW[] PROGMEM             = "Nueva";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Creciente";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "Cuarto creciente";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Creciente gibosa";
+const char TXT_MOON_FULL[] PROGMEM            = "Llena";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Menguante gibosa";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Cuarto menguante";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Menguante";
 
 //Power / WiFi
-const String TXT_POWER  = "Power";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Actualizado:";
+const char TXT_POWER[] PROGMEM  = "Power";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Actualizado:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Velocidad/Dirección viento";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE  = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E   = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE  = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSO";
-const String TXT_SW  = "SO";
-const String TXT_WSW = "OSO";
-const String TXT_W   = "W";
-const String TXT_WNW = "ONO";
-const String TXT_NW  = "NO";
-const String TXT_NNW = "NNO";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Velocidad/Dirección viento";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM  = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM   = "E";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM  = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSO";
+const char TXT_SW[] PROGMEM  = "SO";
+const char TXT_WSW[] PROGMEM = "OSO";
+const char TXT_W[] PROGMEM   = "W";
+const char TXT_WNW[] PROGMEM = "ONO";
+const char TXT_NW[] PROGMEM  = "NO";
+const char TXT_NNW[] PROGMEM = "NNO";
 
 //Day of the week
 const char* weekday_D[] = { "Dom", "Lun", "Mar", "Mié", "Jue", "Vie", "Sáb" };
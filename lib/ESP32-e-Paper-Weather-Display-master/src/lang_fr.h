@@ -1,75 +1,75 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES = "Prévision sur 3 jours";
-const String TXT_CONDITIONS = "Conditions";
-const String TXT_DAYS = "(Jours)";
-const String TXT_TEMPERATURES = "Température";
-const String TXT_TEMPERATURE_C = "Température (°C)";
-const String TXT_TEMPERATURE_F = "Température (°F)";
-const String TXT_HUMIDITY_PERCENT = "Humidité (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM = "Prévision sur 3 jours";
+const char TXT_CONDITIONS[] PROGMEM = "Conditions";
+const char TXT_DAYS[] PROGMEM = "(Jours)";
+const char TXT_TEMPERATURES[] PROGMEM = "Température";
+const char TXT_TEMPERATURE_C[] PROGMEM = "Température (°C)";
+const char TXT_TEMPERATURE_F[] PROGMEM = "Température (°F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Humidité (%)";
 
 // Pressure
-const String TXT_PRESSURE = "Pression";
-const String TXT_PRESSURE_HPA = "Pression (hPa)";
-const String TXT_PRESSURE_IN = "Pression (in)";
-const String TXT_PRESSURE_STEADY = "\nStable";
-const String TXT_PRESSURE_RISING = "\nMontante";
-const String TXT_PRESSURE_FALLING = "\nEn baisse";
+const char TXT_PRESSURE[] PROGMEM = "Pression";
+const char TXT_PRESSURE_HPA[] PROGMEM = "Pression (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM = "Pression (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM = "\nStable";
+const char TXT_PRESSURE_RISING[] PROGMEM = "\nMontante";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "\nEn baisse";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Précipations (mm)";
-const String TXT_RAINFALL_IN = "Précipations (in)";
-const String TXT_SNOWFALL_MM = "Chute de neige (mm)";
-const String TXT_SNOWFALL_IN = "Chute de neige (in)";
-const String TXT_PRECIPITATION_SOON = "Précipitation (proche)";
-const String TXT_RAIN = " Pluie";
-const String TXT_SNOW = " Neige";
-const String TXT_EQUAL_RAIN = "= Pluie";
-const String TXT_EQUAL_SNOW = " = Neige";
+const char TXT_RAINFALL_MM[] PROGMEM = "Précipations (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Précipations (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Chute de neige (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Chute de neige (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Précipitation (proche)";
+const char TXT_RAIN[] PROGMEM = " Pluie";
+const char TXT_SNOW[] PROGMEM = " Neige";
+const char TXT_EQUAL_RAIN[] PROGMEM = "= Pluie";
+const char TXT_EQUAL_SNOW[] PROGMEM = " = Neige";
 
 //Sun
-const String TXT_SUNRISE = "Lever     : ";
+const char TXT_SUNRISE[] PROGMEM = "Lever     : ";
 const int TXT_X_SUNSET = 5;
-const String TXT_SUNSET  = "Coucher : ";
+const char TXT_SUNSET[] PROGMEM  = "Coucher : ";
 
 //Moon
-const String TXT_MOON = "Lune";
-const String TXT_PHASE = "Phase: ";
-const String TXT_MOON_NEW = "Nouvelle";
-const String TXT_MOON_WAXING_CRESCENT = "Premier croissant";
-const String TXT_MOON_FIRST_QUARTER = "Premier quartier";
-const String TXT_MOON_WAXING_GIBBOUS = "Gibbeuse crois.";
-const String TXT_MOON_FULL = "Pleine";
-const String TXT_MOON_WANING_GIBBOUS = "Gibbeuse décrois.";
-const String TXT_MOON_THIRD_QUARTER = "Dernier quartier";
-const String TXT_MOON_WANING_CRESCENT = "Dernier croissant";
+const char TXT_MOON[] PROGMEM = "Lune";
+const char TXT_PHASE[] PROGMEM = "Phase: ";
+const char TXT_MOON_NEW[] PROGMEM = "Nouvelle";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Premier croissant";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM = "Premier quartier";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM = "Gibbeuse crois.";
+const char TXT_MOON_FULL[] PROGMEM = "Pleine";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM = "Gibbeuse décrois.";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM = "Dernier quartier";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Dernier croissant";
 
 //Power / WiFi
-const String TXT_POWER = "Batterie";
+const char TXT_POWER[] PROGMEM = "Batterie";
 const int TXT_X_POWER = 42;
-const String TXT_WIFI = "WiFi";
-const char* TXT_UPDATED = "Mis à jour:";
+const char TXT_WIFI[] PROGMEM = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Mis à jour:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Vitesse & Direction du vent";
-const String TXT_N = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S = "S";
-const String TXT_SSW = "SSO";
-const String TXT_SW = "SO";
-const String TXT_WSW = "OSO";
-const String TXT_W = "O";
-const String TXT_WNW = "ONO";
-const String TXT_NW = "NO";
-const String TXT_NNW = "NNO";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Vitesse & Direction du vent";
+const char TXT_N[] PROGMEM = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM = "E";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM = "S";
+const char TXT_SSW[] PROGMEM = "SSO";
+const char TXT_SW[] PROGMEM = "SO";
+const char TXT_WSW[] PROGMEM = "OSO";
+const char TXT_W[] PROGMEM = "O";
+const char TXT_WNW[] PROGMEM = "ONO";
+const char TXT_NW[] PROGMEM = "NO";
+const char TXT_NNW[] PROGMEM = "NNO";
 
 //Day of the week
 const char* weekday_D[] = { "Dim", "Lun", "Mar", "Mer", "Jeu", "Ven", "Sam" };
@@ -1,66 +1,66 @@
 #define FONT(x) x##_tf
 
 //Temperatur - Luftfeuchtigkeit - Vorschau
-const String TXT_FORECAST_VALUES  = "3 Tages Vorhersage";
-const String TXT_CONDITIONS       = "Aktuelles Wetter";
-const String TXT_DAYS             = "(Tage)";
-const String TXT_TEMPERATURES     = "Temperatur";
-const String TXT_TEMPERATURE_C    = "Temperatur [°C]";
-const String TXT_TEMPERATURE_F    = "Temperatur [°F]";
-const String TXT_HUMIDITY_PERCENT = "Luftfeuchte [%]";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "3 Tages Vorhersage";
+const char TXT_CONDITIONS[] PROGMEM       = "Aktuelles Wetter";
+const char TXT_DAYS[] PROGMEM             = "(Tage)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatur";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatur [°C]";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatur [°F]";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Luftfeuchte [%]";
 
 //Luftdruck
-const String TXT_PRESSURE         = "Luftdruck";
-const String TXT_PRESSURE_HPA     = "Luftdruck [hPa]";
-const String TXT_PRESSURE_IN      = "Luftdruck [in]";
-const String TXT_PRESSURE_STEADY  = "beständig";
-const String TXT_PRESSURE_RISING  = "steigend";
-const String TXT_PRESSURE_FALLING = "fallend";
+const char TXT_PRESSURE[] PROGMEM         = "Luftdruck";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Luftdruck [hPa]";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Luftdruck [in]";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "beständig";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "steigend";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "fallend";
 
 //Niederschlag / Schneefall
-const String TXT_RAINFALL_MM = "mm Regen";
-const String TXT_RAINFALL_IN = "in Regen";
-const String TXT_SNOWFALL_MM = "mm Schnee";
-const String TXT_SNOWFALL_IN = "in Schnee";
-const String TXT_PRECIPITATION_SOON = "in Kürze";
+const char TXT_RAINFALL_MM[] PROGMEM = "mm Regen";
+const char TXT_RAINFALL_IN[] PROGMEM = "in Regen";
+const char TXT_SNOWFALL_MM[] PROGMEM = "mm Schnee";
+const char TXT_SNOWFALL_IN[] PROGMEM = "in Schnee";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "in Kürze";
 
 //Sonne
-const String TXT_SUNRISE  = "Sonnenaufg.";
-const String TXT_SUNSET   = "Sonnenunterg.";
+const char TXT_SUNRISE[] PROGMEM  = "Sonnenaufg.";
+const char TXT_SUNSET[] PROGMEM   = "Sonnenunterg.";
 
 //Mond
-const String TXT_MOON_NEW             = "Neumond";          // Neumond
-const String TXT_MOON_WAXING_CRESCENT = "zunehmende  Sichel";   // erstes Viertel bzw. zunehmende Sichel
-const String TXT_MOON_FIRST_QUARTER   = "zunehmender Halbmond";   // zunehmender Halbmond 
-const String TXT_MOON_WAXING_GIBBOUS  = "zweites Viertel";      // zweites Viertel
-const String TXT_MOON_FULL            = "Vollmond";         // Vollmond
-const String TXT_MOON_WANING_GIBBOUS  = "drittes Viertel";      // drittes Viertel 
-const String TXT_MOON_THIRD_QUARTER   = "abnehmender Halbmond";   // abnehmender Halbmond
-const String TXT_MOON_WANING_CRESCENT = "abnehmende Sichel";    // letztes Viertel bzw. abnehmende Sichel 
+const char TXT_MOON_NEW[] PROGMEM             = "Neumond";          // Neumond
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "zunehmende  Sichel";   // erstes Viertel bzw. zunehmende Sichel
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "zunehmender Halbmond";   // zunehmender Halbmond 
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "zweites Viertel";      // zweites Viertel
+const char TXT_MOON_FULL[] PROGMEM            = "Vollmond";         // Vollmond
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "drittes Viertel";      // drittes Viertel 
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "abnehmender Halbmond";   // abnehmender Halbmond
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "abnehmende Sichel";    // letztes Viertel bzw. abnehmende Sichel 
 
 //Energie / WLAN
-const String TXT_POWER  = "Akku";
-const String TXT_WIFI   = "WLAN";
-const char* TXT_UPDATED = "aktualisiert:";
+const char TXT_POWER[] PROGMEM  = "Akku";
+const char TXT_WIFI[] PROGMEM   = "WLAN";
+const char TXT_UPDATED[] PROGMEM = "aktualisiert:";
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Wind Geschw./Richtung";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNO";
-const String TXT_NE  = "NO";
-const String TXT_ENE = "ONO";
-const String TXT_E   = "O";
-const String TXT_ESE = "OSO";
-const String TXT_SE  = "SO";
-const String TXT_SSE = "SSO";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSW";
-const String TXT_SW  = "SW";
-const String TXT_WSW = "WSW";
-const String TXT_W   = "W";
-const String TXT_WNW = "WNW";
-const String TXT_NW  = "NW";
-const String TXT_NNW = "NNW";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Wind Geschw./Richtung";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNO";
+const char TXT_NE[] PROGMEM  = "NO";
+const char TXT_ENE[] PROGMEM = "ONO";
+const char TXT_E[] PROGMEM   = "O";
+const char TXT_ESE[] PROGMEM = "OSO";
+const char TXT_SE[] PROGMEM  = "SO";
+const char TXT_SSE[] PROGMEM = "SSO";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSW";
+const char TXT_SW[] PROGMEM  = "SW";
+const char TXT_WSW[] PROGMEM = "WSW";
+const char TXT_W[] PROGMEM   = "W";
+const char TXT_WNW[] PROGMEM = "WNW";
+const char TXT_NW[] PROGMEM  = "NW";
+const char TXT_NNW[] PROGMEM = "NNW";
 
 //Wochentag
 /*
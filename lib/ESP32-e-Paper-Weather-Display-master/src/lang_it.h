@@ -1,75 +1,75 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES = "Previsioni a 3 giorni";
-const String TXT_CONDITIONS = "Condizioni";
-const String TXT_DAYS = "(Giorni)";
-const String TXT_TEMPERATURES = "Temperature";
-const String TXT_TEMPERATURE_C = "Temperatura (°C)";
-const String TXT_TEMPERATURE_F = "Temperatura (°F)";
-const String TXT_HUMIDITY_PERCENT = "Umidità (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM = "Previsioni a 3 giorni";
+const char TXT_CONDITIONS[] PROGMEM = "Condizioni";
+const char TXT_DAYS[] PROGMEM = "(Giorni)";
+const char TXT_TEMPERATURES[] PROGMEM = "Temperature";
+const char TXT_TEMPERATURE_C[] PROGMEM = "Temperatura (°C)";
+const char TXT_TEMPERATURE_F[] PROGMEM = "Temperatura (°F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Umidità (%)";
 
 // Pressure
-const String TXT_PRESSURE = "Pressione";
-const String TXT_PRESSURE_HPA = "Pressione (hPa)";
-const String TXT_PRESSURE_IN = "Pressione (in)";
-const String TXT_PRESSURE_STEADY = "\nCostante";
-const String TXT_PRESSURE_RISING = "\nCrescente";
-const String TXT_PRESSURE_FALLING = "\nDiminuzione";
+const char TXT_PRESSURE[] PROGMEM = "Pressione";
+const char TXT_PRESSURE_HPA[] PROGMEM = "Pressione (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM = "Pressione (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM = "\nCostante";
+const char TXT_PRESSURE_RISING[] PROGMEM = "\nCrescente";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "\nDiminuzione";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Piogge (mm)";
-const String TXT_RAINFALL_IN = "Piogge (in)";
-const String TXT_SNOWFALL_MM = "Neve (mm)";
-const String TXT_SNOWFALL_IN = "Neve (in)";
-const String TXT_PRECIPITATION_SOON = "Precipitazioni (breve)";
-const String TXT_RAIN = " Pioggia";
-const String TXT_SNOW = " Neve";
-const String TXT_EQUAL_RAIN = " = Pioggia";
-const String TXT_EQUAL_SNOW = " = Neve";
+const char TXT_RAINFALL_MM[] PROGMEM = "Piogge (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Piogge (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Neve (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Neve (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Precipitazioni (breve)";
+const char TXT_RAIN[] PROGMEM = " Pioggia";
+const char TXT_SNOW[] PROGMEM = " Neve";
+const char TXT_EQUAL_RAIN[] PROGMEM = " = Pioggia";
+const char TXT_EQUAL_SNOW[] PROGMEM = " = Neve";
 
 //Sun
-const String TXT_SUNRISE = "Alba: ";
+const char TXT_SUNRISE[] PROGMEM = "Alba: ";
 const int TXT_X_SUNSET = 16; 
-const String TXT_SUNSET  = "     Tra: ";
+const char TXT_SUNSET[] PROGMEM  = "     Tra: ";
 
 //Moon
-const String TXT_MOON = "Luna";
-const String TXT_PHASE = "Fase: ";
-const String TXT_MOON_NEW = "Luna nuova";
-const String TXT_MOON_WAXING_CRESCENT = "Luna crescente";
-const String TXT_MOON_FIRST_QUARTER = "Primo quarto";
-const String TXT_MOON_WAXING_GIBBOUS = "Gibbosa crescente";
-const String TXT_MOON_FULL = "Luna Piena";
-const String TXT_MOON_WANING_GIBBOUS = "Gibbosa calante";
-const String TXT_MOON_THIRD_QUARTER = "Ultimo quarto";
-const String TXT_MOON_WANING_CRESCENT = "Luna calante";
+const char TXT_MOON[] PROGMEM = "Luna";
+const char TXT_PHASE[] PROGMEM = "Fase: ";
+const char TXT_MOON_NEW[] PROGMEM = "Luna nuova";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Luna crescente";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM = "Primo quarto";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM = "Gibbosa crescente";
+const char TXT_MOON_FULL[] PROGMEM = "Luna Piena";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM = "Gibbosa calante";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM = "Ultimo quarto";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Luna calante";
 
 //Power / WiFi
-const String TXT_POWER = "Segnale";
+const char TXT_POWER[] PROGMEM = "Segnale";
 const int TXT_X_POWER = 45;
-const String TXT_WIFI = "WiFi";
-const char* TXT_UPDATED = "Aggiornato:";
+const char TXT_WIFI[] PROGMEM = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Aggiornato:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Velocità e Direzione Vento";
-const String TXT_N = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S = "S";
-const String TXT_SSW = "SSO";
-const String TXT_SW = "SO";
-const String TXT_WSW = "OSO";
-const String TXT_W = "O";
-const String TXT_WNW = "ONO";
-const String TXT_NW = "NO";
-const String TXT_NNW = "NNO";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Velocità e Direzione Vento";
+const char TXT_N[] PROGMEM = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM = "E";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM = "S";
+const char TXT_SSW[] PROGMEM = "SSO";
+const char TXT_SW[] PROGMEM = "SO";
+const char TXT_WSW[] PROGMEM = "OSO";
+const char TXT_W[] PROGMEM = "O";
+const char TXT_WNW[] PROGMEM = "ONO";
+const char TXT_NW[] PROGMEM = "NO";
+const char TXT_NNW[] PROGMEM = "NNO";
 
 
 //Day of the week
@@ -1,68 +1,68 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "3-Daagse weersvoorspelling";
-const String TXT_CONDITIONS       = "Weersomstandigheden";
-const String TXT_DAYS             = "(Dagen)";
-const String TXT_TEMPERATURES     = "Temperatuur";
-const String TXT_TEMPERATURE_C    = "Temperatuur (*C)";
-const String TXT_TEMPERATURE_F    = "Temperatuur (*F)";
-const String TXT_HUMIDITY_PERCENT = "Luchtvochtigheid (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "3-Daagse weersvoorspelling";
+const char TXT_CONDITIONS[] PROGMEM       = "Weersomstandigheden";
+const char TXT_DAYS[] PROGMEM             = "(Dagen)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatuur";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatuur (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatuur (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Luchtvochtigheid (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Luchtdruk";
-const String TXT_PRESSURE_HPA     = "Luchtdruk (hPa)";
-const String TXT_PRESSURE_IN      = "Luchtdruk (in)";
-const String TXT_PRESSURE_STEADY  = "Stabiel";
-const String TXT_PRESSURE_RISING  = "Steigend";
-const String TXT_PRESSURE_FALLING = "Dalend";
+const char TXT_PRESSURE[] PROGMEM         = "Luchtdruk";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Luchtdruk (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Luchtdruk (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Stabiel";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Steigend";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Dalend";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Neerslag (mm)";
-const String TXT_RAINFALL_IN = "Neerslag (in)";
-const String TXT_SNOWFALL_MM = "Sneeuwval (mm)";
-const String TXT_SNOWFALL_IN = "Sneeuwval (in)";
-const String TXT_PRECIPITATION_SOON = "Neerslag";
+const char TXT_RAINFALL_MM[] PROGMEM = "Neerslag (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Neerslag (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Sneeuwval (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Sneeuwval (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Neerslag";
 
 
 //Sun
-const String TXT_SUNRISE  = "Zonsopgang";
-const String TXT_SUNSET   = "Zonsondergang";
+const char TXT_SUNRISE[] PROGMEM  = "Zonsopgang";
+const char TXT_SUNSET[] PROGMEM   = "Zonsondergang";
 
 //Moon
-const String TXT_MOON_NEW             = "Nieuwe maan";
-const String TXT_MOON_WAXING_CRESCENT = "wassende maan";
-const String TXT_MOON_FIRST_QUARTER   = "Eerste kwartier";
-const String TXT_MOON_WAXING_GIBBOUS  = "Wassende maan";
-const String TXT_MOON_FULL            = "Volle maan";
-const String TXT_MOON_WANING_GIBBOUS  = "Krimpende maan";
-const String TXT_MOON_THIRD_QUARTER   = "Laatste kwartier";
-const String TXT_MOON_WANING_CRESCENT = "Krimpende maan";
+const char TXT_MOON_NEW[] PROGMEM             = "Nieuwe maan";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "wassende maan";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "Eerste kwartier";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Wassende maan";
+const char TXT_MOON_FULL[] PROGMEM            = "Volle maan";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Krimpende maan";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Laatste kwartier";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Krimpende maan";
 
 //Power / WiFi
-const String TXT_POWER  = "Accu";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Bijgewerkt:";
+const char TXT_POWER[] PROGMEM  = "Accu";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Bijgewerkt:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Windstreek en snelheid";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNO";
-const String TXT_NE  = "NO";
-const String TXT_ENE = "ONO";
-const String TXT_E   = "O";
-const String TXT_ESE = "OZO";
-const String TXT_SE  = "ZO";
-const String TXT_SSE = "ZZO";
-const String TXT_S   = "Z";
-const String TXT_SSW = "ZZW";
-const String TXT_SW  = "ZW";
-const String TXT_WSW = "WZW";
-const String TXT_W   = "W";
-const String TXT_WNW = "WNW";
-const String TXT_NW  = "NW";
-const String TXT_NNW = "NNW";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Windstreek en snelheid";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNO";
+const char TXT_NE[] PROGMEM  = "NO";
+const char TXT_ENE[] PROGMEM = "ONO";
+const char TXT_E[] PROGMEM   = "O";
+const char TXT_ESE[] PROGMEM = "OZO";
+const char TXT_SE[] PROGMEM  = "ZO";
+const char TXT_SSE[] PROGMEM = "ZZO";
+const char TXT_S[] PROGMEM   = "Z";
+const char TXT_SSW[] PROGMEM = "ZZW";
+const char TXT_SW[] PROGMEM  = "ZW";
+const char TXT_WSW[] PROGMEM = "WZW";
+const char TXT_W[] PROGMEM   = "W";
+const char TXT_WNW[] PROGMEM = "WNW";
+const char TXT_NW[] PROGMEM  = "NW";
+const char TXT_NNW[] PROGMEM = "NNW";
 
 //Day of the week
 const char* weekday_D[] = { "Zo", "Ma", "Di", "Wo", "Do", "Vr", "Za" };
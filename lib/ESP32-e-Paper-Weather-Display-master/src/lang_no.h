@@ -1,68 +1,68 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "3 dagers værvarsel";
-const String TXT_CONDITIONS       = "Tilstand";
-const String TXT_DAYS             = "(Dager)";
-const String TXT_TEMPERATURES     = "Temperatur";
-const String TXT_TEMPERATURE_C    = "Temperatur (*C)";
-const String TXT_TEMPERATURE_F    = "Temperatur (*F)";
-const String TXT_HUMIDITY_PERCENT = "Luftfuktighet (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "3 dagers værvarsel";
+const char TXT_CONDITIONS[] PROGMEM       = "Tilstand";
+const char TXT_DAYS[] PROGMEM             = "(Dager)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatur";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatur (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatur (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Luftfuktighet (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Lufttrykk";
-const String TXT_PRESSURE_HPA     = "Lufttrykk(hPa)";
-const String TXT_PRESSURE_IN      = "Lufttrykk (in)";
-const String TXT_PRESSURE_STEADY  = "Stabilt";
-const String TXT_PRESSURE_RISING  = "Stigende";
-const String TXT_PRESSURE_FALLING = "Fallende";
+const char TXT_PRESSURE[] PROGMEM         = "Lufttrykk";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Lufttrykk(hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Lufttrykk (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Stabilt";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Stigende";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Fallende";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Regn (mm)";
-const String TXT_RAINFALL_IN = "Regn (in)";
-const String TXT_SNOWFALL_MM = "Snø (mm)";
-const String TXT_SNOWFALL_IN = "Snø (in)";
-const String TXT_PRECIPITATION_SOON = "Nedbør";
+const char TXT_RAINFALL_MM[] PROGMEM = "Regn (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Regn (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Snø (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Snø (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Nedbør";
 
 
 //Sun
-const String TXT_SUNRISE  = "Solopp.";
-const String TXT_SUNSET   = "Solned.";
+const char TXT_SUNRISE[] PROGMEM  = "Solopp.";
+const char TXT_SUNSET[] PROGMEM   = "Solned.";
 
 //Moon
-const String TXT_MOON_NEW             = "Nymåne";
-const String TXT_MOON_WAXING_CRESCENT = "Vokse-må.sigd";
-const String TXT_MOON_FIRST_QUARTER   = "Halvmåne,vok.";
-const String TXT_MOON_WAXING_GIBBOUS  = "Voksemåne,ny";
-const String TXT_MOON_FULL            = "Fullmåne";
-const String TXT_MOON_WANING_GIBBOUS  = "Minkemåne,ne";
-const String TXT_MOON_THIRD_QUARTER   = "Halvmåne,min.";
-const String TXT_MOON_WANING_CRESCENT = "Minke-må.sigd";
+const char TXT_MOON_NEW[] PROGMEM             = "Nymåne";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Vokse-må.sigd";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "Halvmåne,vok.";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Voksemåne,ny";
+const char TXT_MOON_FULL[] PROGMEM            = "Fullmåne";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Minkemåne,ne";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Halvmåne,min.";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Minke-må.sigd";
 
 //Power / WiFi
-const String TXT_POWER  = "Batteri";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Oppdatert:";
+const char TXT_POWER[] PROGMEM  = "Batteri";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Oppdatert:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Wind Speed/Direction";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNØ";
-const String TXT_NE  = "NØ";
-const String TXT_ENE = "ØNØ";
-const String TXT_E   = "Ø";
-const String TXT_ESE = "ØSØ";
-const String TXT_SE  = "SØ";
-const String TXT_SSE = "SSØ";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSV";
-const String TXT_SW  = "SV";
-const String TXT_WSW = "VSV";
-const String TXT_W   = "V";
-const String TXT_WNW = "VNV";
-const String TXT_NW  = "NV";
-const String TXT_NNW = "NNV";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Wind Speed/Direction";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNØ";
+const char TXT_NE[] PROGMEM  = "NØ";
+const char TXT_ENE[] PROGMEM = "ØNØ";
+const char TXT_E[] PROGMEM   = "Ø";
+const char TXT_ESE[] PROGMEM = "ØSØ";
+const char TXT_SE[] PROGMEM  = "SØ";
+const char TXT_SSE[] PROGMEM = "SSØ";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSV";
+const char TXT_SW[] PROGMEM  = "SV";
+const char TXT_WSW[] PROGMEM = "VSV";
+const char TXT_W[] PROGMEM   = "V";
+const char TXT_WNW[] PROGMEM = "VNV";
+const char TXT_NW[] PROGMEM  = "NV";
+const char TXT_NNW[] PROGMEM = "NNV";
 
 //Day of the week
 const char* weekday_D[] = { "Søn", "Man", "Tir", "Ons", "Tor", "Fre", "Lør" };
@@ -1,69 +1,69 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "Prognoza 3-dniowa";
-const String TXT_CONDITIONS       = "Warunki";
-const String TXT_DAYS             = "(dni)";
-const String TXT_TEMPERATURES     = "Temperatura";
-const String TXT_TEMPERATURE_C    = "Temperatura (*C)";
-const String TXT_TEMPERATURE_F    = "Temperatura (*F)";
-const String TXT_HUMIDITY_PERCENT = "Wilgotność (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "Prognoza 3-dniowa";
+const char TXT_CONDITIONS[] PROGMEM       = "Warunki";
+const char TXT_DAYS[] PROGMEM             = "(dni)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatura";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatura (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatura (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Wilgotność (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Ciśnienie";
-const String TXT_PRESSURE_HPA     = "Ciśnienie (hPa)";
-const String TXT_PRESSURE_IN      = "Ciśnienie (in)";
-const String TXT_PRESSURE_STEADY  = "Stałe";
-const String TXT_PRESSURE_RISING  = "Rośnie";
-const String TXT_PRESSURE_FALLING = "Spada";
+const char TXT_PRESSURE[] PROGMEM         = "Ciśnienie";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Ciśnienie (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Ciśnienie (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Stałe";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Rośnie";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Spada";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Deszcz (mm)";
-const String TXT_RAINFALL_IN = "Deszcz (in)";
-const String TXT_SNOWFALL_MM = "Śnieg (mm)";
-const String TXT_SNOWFALL_IN = "Śnieg (in)";
-const String TXT_PRECIPITATION_SOON = "Opad.";
+const char TXT_RAINFALL_MM[] PROGMEM = "Deszcz (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Deszcz (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Śnieg (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Śnieg (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Opad.";
 
 
 //Sun
-const String TXT_SUNRISE  = "Wschód sł.";
-const String TXT_SUNSET   = "Zachód sł.";
+const char TXT_SUNRISE[] PROGMEM  = "Wschód sł.";
+const char TXT_SUNSET[] PROGMEM   = "Zachód sł.";
 
 //Moon
-const String TXT_MOON_NEW             = "Nów";
-const String TXT_MOON_WAXING_CRESCENT = "Przybywający sierp";
-const String TXT_MOON_FIRST_QUARTER   = "Pierwsza kwadra";
-const String TXT_MOON_WAXING_GIBBOUS  = "Przybywający garbaty";
-const String TXT_MOON_FULL            = "Pełnia";
-const String TXT_MOON_WANING_GIBBOUS  = "Ubywający garbaty";
-const String TXT_MOON_THIRD_QUARTER   = "Ostatnia kwadra";
-const String TXT_MOON_WANING_CRESCENT = "Ubywający sierp ";
+const char TXT_MOON_NEW[] PROGMEM             = "Nów";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Przybywający sierp";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "Pierwsza kwadra";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Przybywający garbaty";
+const char TXT_MOON_FULL[] PROGMEM            = "Pełnia";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Ubywający garbaty";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Ostatnia kwadra";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Ubywający sierp ";
 
 //Power / WiFi
-const String TXT_POWER  = "Zasilanie";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Aktualizacja:";
+const char TXT_POWER[] PROGMEM  = "Zasilanie";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Aktualizacja:";
 
 
 //Wind
 //These are left untranslated due to string length constraints, but usually we use the English notation anyway
-const String TXT_WIND_SPEED_DIRECTION = "Prędkość/Kierunek wiatru";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE  = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E   = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE  = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSW";
-const String TXT_SW  = "SW";
-const String TXT_WSW = "WSW";
-const String TXT_W   = "W";
-const String TXT_WNW = "WNW";
-const String TXT_NW  = "NW";
-const String TXT_NNW = "NNW";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Prędkość/Kierunek wiatru";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM  = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM   = "E";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM  = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSW";
+const char TXT_SW[] PROGMEM  = "SW";
+const char TXT_WSW[] PROGMEM = "WSW";
+const char TXT_W[] PROGMEM   = "W";
+const char TXT_WNW[] PROGMEM = "WNW";
+const char TXT_NW[] PROGMEM  = "NW";
+const char TXT_NNW[] PROGMEM = "NNW";
 
 //Day of the week
 const char* weekday_D[] = { "Nie", "Pon", "Wto", "Śro", "Czw", "Pią", "Sob" };
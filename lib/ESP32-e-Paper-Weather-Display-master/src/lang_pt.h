@@ -1,68 +1,68 @@
 #define FONT(x) x##_tf
 
 //Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "Previsão 3 dias";
-const String TXT_CONDITIONS       = "Condições";
-const String TXT_DAYS             = "(Dias)";
-const String TXT_TEMPERATURES     = "Temperatura";
-const String TXT_TEMPERATURE_C    = "Temperatura (*C)";
-const String TXT_TEMPERATURE_F    = "Temperatura (*F)";
-const String TXT_HUMIDITY_PERCENT = "Umidade (%)";
+const char TXT_FORECAST_VALUES[] PROGMEM  = "Previsão 3 dias";
+const char TXT_CONDITIONS[] PROGMEM       = "Condições";
+const char TXT_DAYS[] PROGMEM             = "(Dias)";
+const char TXT_TEMPERATURES[] PROGMEM     = "Temperatura";
+const char TXT_TEMPERATURE_C[] PROGMEM    = "Temperatura (*C)";
+const char TXT_TEMPERATURE_F[] PROGMEM    = "Temperatura (*F)";
+const char TXT_HUMIDITY_PERCENT[] PROGMEM = "Umidade (%)";
 
 // Pressure
-const String TXT_PRESSURE         = "Pressão";
-const String TXT_PRESSURE_HPA     = "Pressão (hPa)";
-const String TXT_PRESSURE_IN      = "Pressão (in)";
-const String TXT_PRESSURE_STEADY  = "Estável";
-const String TXT_PRESSURE_RISING  = "Subindo";
-const String TXT_PRESSURE_FALLING = "Baixando";
+const char TXT_PRESSURE[] PROGMEM         = "Pressão";
+const char TXT_PRESSURE_HPA[] PROGMEM     = "Pressão (hPa)";
+const char TXT_PRESSURE_IN[] PROGMEM      = "Pressão (in)";
+const char TXT_PRESSURE_STEADY[] PROGMEM  = "Estável";
+const char TXT_PRESSURE_RISING[] PROGMEM  = "Subindo";
+const char TXT_PRESSURE_FALLING[] PROGMEM = "Baixando";
 
 //RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Chuva (mm)";
-const String TXT_RAINFALL_IN = "Chuva (in)";
-const String TXT_SNOWFALL_MM = "Neve (mm)";
-const String TXT_SNOWFALL_IN = "Neve (in)";
-const String TXT_PRECIPITATION_SOON = "Prec.";
+const char TXT_RAINFALL_MM[] PROGMEM = "Chuva (mm)";
+const char TXT_RAINFALL_IN[] PROGMEM = "Chuva (in)";
+const char TXT_SNOWFALL_MM[] PROGMEM = "Neve (mm)";
+const char TXT_SNOWFALL_IN[] PROGMEM = "Neve (in)";
+const char TXT_PRECIPITATION_SOON[] PROGMEM = "Prec.";
 
 
 //Sun
-const String TXT_SUNRISE  = "Amanhecer";
-const String TXT_SUNSET   = "Anoitecer";
+const char TXT_SUNRISE[] PROGMEM  = "Amanhecer";
+const char TXT_SUNSET[] PROGMEM   = "Anoitecer";
 
 //Moon
-const String TXT_MOON_NEW             = "Nova";
-const String TXT_MOON_WAXING_CRESCENT = "Crescente";
-const String TXT_MOON_FIRST_QUARTER   = "Quarto crescente";
-const String TXT_MOON_WAXING_GIBBOUS  = "Crescente gibosa";
-const String TXT_MOON_FULL            = "Cheia";
-const String TXT_MOON_WANING_GIBBOUS  = "Minguante gibosa";
-const String TXT_MOON_THIRD_QUARTER   = "Quarto minguante";
-const String TXT_MOON_WANING_CRESCENT = "Minguante";
+const char TXT_MOON_NEW[] PROGMEM             = "Nova";
+const char TXT_MOON_WAXING_CRESCENT[] PROGMEM = "Crescente";
+const char TXT_MOON_FIRST_QUARTER[] PROGMEM   = "Quarto crescente";
+const char TXT_MOON_WAXING_GIBBOUS[] PROGMEM  = "Crescente gibosa";
+const char TXT_MOON_FULL[] PROGMEM            = "Cheia";
+const char TXT_MOON_WANING_GIBBOUS[] PROGMEM  = "Minguante gibosa";
+const char TXT_MOON_THIRD_QUARTER[] PROGMEM   = "Quarto minguante";
+const char TXT_MOON_WANING_CRESCENT[] PROGMEM = "Minguante";
 
 //Power / WiFi
-const String TXT_POWER  = "Power";
-const String TXT_WIFI   = "WiFi";
-const char* TXT_UPDATED = "Atualizado:";
+const char TXT_POWER[] PROGMEM  = "Power";
+const char TXT_WIFI[] PROGMEM   = "WiFi";
+const char TXT_UPDATED[] PROGMEM = "Atualizado:";
 
 
 //Wind
-const String TXT_WIND_SPEED_DIRECTION = "Velocidade/Direção vento";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE  = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E   = "L";
-const String TXT_ESE = "ESE";
-const String TXT_SE  = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSO";
-const String TXT_SW  = "SO";
-const String TXT_WSW = "OSO";
-const String TXT_W   = "O";
-const String TXT_WNW = "ONO";
-const String TXT_NW  = "NO";
-const String TXT_NNW = "NNO";
+const char TXT_WIND_SPEED_DIRECTION[] PROGMEM = "Velocidade/Direção vento";
+const char TXT_N[] PROGMEM   = "N";
+const char TXT_NNE[] PROGMEM = "NNE";
+const char TXT_NE[] PROGMEM  = "NE";
+const char TXT_ENE[] PROGMEM = "ENE";
+const char TXT_E[] PROGMEM   = "L";
+const char TXT_ESE[] PROGMEM = "ESE";
+const char TXT_SE[] PROGMEM  = "SE";
+const char TXT_SSE[] PROGMEM = "SSE";
+const char TXT_S[] PROGMEM   = "S";
+const char TXT_SSW[] PROGMEM = "SSO";
+const char TXT_SW[] PROGMEM  = "SO";
+const char TXT_WSW[] PROGMEM = "OSO";
+const char TXT_W[] PROGMEM   = "O";
+const char TXT_WNW[] PROGMEM = "ONO";
+const char TXT_NW[] PROGMEM  = "NO";
+const char TXT_NNW[] PROGMEM = "NNO";
 
 //Day of the week
 const char* weekday_D[] = { "Dom", "Seg", "Ter", "Qua", "Qui", "Sex", "Sáb" };
@@ -0,0 +1,355 @@
+#pragma once
+// The Adafruit GFX primitives the display code and U8g2_for_Adafruit_GFX use, following the
+// library's own algorithms so host frames match what the panel shows pixel for pixel
+#include <Arduino.h>
+
+typedef struct
+{
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+typedef struct
+{
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print
+{
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h), wrap(true) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+        for (int16_t i = 0; i < h; i++)
+            drawPixel(x, y + i, color);
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+        for (int16_t i = 0; i < w; i++)
+            drawPixel(x + i, y, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        for (int16_t i = x; i < x + w; i++)
+            drawFastVLine(i, y, h, color);
+    }
+
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        if (x0 == x1)
+        {
+            if (y0 > y1)
+                std::swap(y0, y1);
+            drawFastVLine(x0, y0, y1 - y0 + 1, color);
+        }
+        else if (y0 == y1)
+        {
+            if (x0 > x1)
+                std::swap(x0, x1);
+            drawFastHLine(x0, y0, x1 - x0 + 1, color);
+        }
+        else
+            writeLine(x0, y0, x1, y1, color);
+    }
+
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep)
+        {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+        if (x0 > x1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = y0 < y1 ? 1 : -1;
+
+        for (; x0 <= x1; x0++)
+        {
+            if (steep)
+                drawPixel(y0, x0, color);
+            else
+                drawPixel(x0, y0, color);
+            err -= dy;
+            if (err < 0)
+            {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+    {
+        int16_t a, b, y, last;
+
+        // Sort coordinates by Y order (y2 >= y1 >= y0)
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            std::swap(y2, y1);
+            std::swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        { // all on the same line
+            a = b = x0;
+            if (x1 < a)
+                a = x1;
+            else if (x1 > b)
+                b = x1;
+            if (x2 < a)
+                a = x2;
+            else if (x2 > b)
+                b = x2;
+            drawFastHLine(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+
+        // Upper part, including the y1 scanline only if the lower part is flat
+        last = y1 == y2 ? y1 : y1 - 1;
+        for (y = y0; y <= last; y++)
+        {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b)
+                std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+
+        // Lower part
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b)
+                std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+        drawPixel(x0, y0 + r, color);
+        drawPixel(x0, y0 - r, color);
+        drawPixel(x0 + r, y0, color);
+        drawPixel(x0 - r, y0, color);
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            drawPixel(x0 + x, y0 + y, color);
+            drawPixel(x0 - x, y0 + y, color);
+            drawPixel(x0 + x, y0 - y, color);
+            drawPixel(x0 - x, y0 - y, color);
+            drawPixel(x0 + y, y0 + x, color);
+            drawPixel(x0 - y, y0 + x, color);
+            drawPixel(x0 + y, y0 - x, color);
+            drawPixel(x0 - y, y0 - x, color);
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+    {
+        int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+        delta++; // Avoid some +1's in the loop
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1))
+            {
+                if (corners & 1)
+                    drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+                if (corners & 2)
+                    drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+            if (y != py)
+            {
+                if (corners & 1)
+                    drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+                if (corners & 2)
+                    drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+    {
+        int16_t byteWidth = (w + 7) / 8;
+        uint8_t b = 0;
+        for (int16_t j = 0; j < h; j++, y++)
+        {
+            for (int16_t i = 0; i < w; i++)
+            {
+                if (i & 7)
+                    b <<= 1;
+                else
+                    b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+                if (b & 0x80)
+                    drawPixel(x + i, y, color);
+            }
+        }
+    }
+
+    // Bounds in the built in 6x8 font, which is what drawString measures with
+    void getTextBounds(const char *text, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+    {
+        int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+        *x1 = x;
+        *y1 = y;
+        *w = *h = 0;
+        for (; *text; text++)
+        {
+            if (*text == '\n')
+            {
+                x = 0;
+                y += 8;
+            }
+            else if (*text != '\r')
+            {
+                if (wrap && x + 6 > _width)
+                {
+                    x = 0;
+                    y += 8;
+                }
+                minx = min(minx, x);
+                miny = min(miny, y);
+                maxx = max(maxx, (int16_t)(x + 5));
+                maxy = max(maxy, (int16_t)(y + 7));
+                x += 6;
+            }
+        }
+        if (maxx >= minx)
+        {
+            *x1 = minx;
+            *w = maxx - minx + 1;
+        }
+        if (maxy >= miny)
+        {
+            *y1 = miny;
+            *h = maxy - miny + 1;
+        }
+    }
+
+    void setTextWrap(bool w) { wrap = w; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    size_t write(uint8_t) override { return 1; } // only u8g2 draws text here
+
+protected:
+    int16_t _width, _height;
+    bool wrap;
+};
+
+// 1 bpp off-screen buffer, rows of (w + 7) / 8 bytes with the leftmost pixel in the top bit, as in the library
+class GFXcanvas1 : public Adafruit_GFX
+{
+public:
+    GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h), buffer((uint8_t *)malloc((size_t)((w + 7) / 8) * h))
+    {
+        if (buffer != NULL)
+            memset(buffer, 0, (size_t)((w + 7) / 8) * h);
+    }
+    ~GFXcanvas1() { free(buffer); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (buffer == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+            return;
+        uint8_t *target = &buffer[(x / 8) + y * ((_width + 7) / 8)];
+        if (color)
+            *target |= 0x80 >> (x & 7);
+        else
+            *target &= ~(0x80 >> (x & 7));
+    }
+
+    void fillScreen(uint16_t color) override
+    {
+        if (buffer != NULL)
+            memset(buffer, color ? 0xFF : 0x00, (size_t)((_width + 7) / 8) * _height);
+    }
+
+    bool getPixel(int16_t x, int16_t y) const
+    {
+        if (buffer == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+            return false;
+        return buffer[(x / 8) + y * ((_width + 7) / 8)] & (0x80 >> (x & 7));
+    }
+
+    uint8_t *getBuffer() const { return buffer; }
+
+private:
+    uint8_t *buffer;
+};
@@ -0,0 +1,127 @@
+#pragma once
+// Just enough of the Arduino core for the display code to build on the host, see platformio.ini [env:render_proxy]
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define F(text) (text)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) (*(void *const *)(addr))
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline unsigned long ElapsedMicros()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+inline unsigned long micros() { return ElapsedMicros(); }
+inline unsigned long millis() { return ElapsedMicros() / 1000; }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void yield() {}
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline long random(long howBig) { return howBig > 0 ? rand() % howBig : 0; }
+inline long random(long howSmall, long howBig) { return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall; }
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+    size_t print(const char *text) { return write(text); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(int value) { return print((long)value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(unsigned int value) { return print((unsigned long)value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+    template <typename T>
+    size_t println(T value) { return print(value) + print("\n"); }
+    template <typename T>
+    size_t println(T value, int digits) { return print(value, digits) + print("\n"); }
+    size_t println() { return print("\n"); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char text[256];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(text, sizeof(text), format, args);
+        va_end(args);
+        return write((const uint8_t *)text, min((size_t)max(length, 0), sizeof(text) - 1));
+    }
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+    virtual size_t readBytes(char *buffer, size_t length)
+    {
+        size_t count = 0;
+        int c;
+        while (count < length && (c = read()) >= 0)
+            buffer[count++] = (char)c;
+        return count;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+    void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+    unsigned long getTimeout() { return timeout; }
+
+protected:
+    unsigned long timeout = 1000;
+};
+
+// Diagnostics go to stderr so stdout stays free for the renderer's output. Host tools that time
+// code which logs (the parse benchmark) can mute it
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    void mute(bool muted) { Muted() = muted; }
+    size_t write(uint8_t c) override { return Muted() || fputc(c, stderr) != EOF ? 1 : 0; }
+    using Print::write;
+
+private:
+    // each translation unit has its own Serial, so muting one has to mute them all
+    static bool &Muted()
+    {
+        static bool muted = false;
+        return muted;
+    }
+};
+
+static HostSerial Serial;
@@ -0,0 +1,20 @@
+#pragma once
+#include <Arduino.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// The panels panel.h can select; on the host only their size matters
+#define GXEPD2_SHIM_PANEL(name, width, height)                       \
+    class name                                                       \
+    {                                                                \
+    public:                                                          \
+        static const uint16_t WIDTH = width;                         \
+        static const uint16_t HEIGHT = height;                       \
+        name(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {}   \
+    };
+
+GXEPD2_SHIM_PANEL(GxEPD2_750_T7, 800, 480)
+GXEPD2_SHIM_PANEL(GxEPD2_750_GDEY075T7, 800, 480)
+GXEPD2_SHIM_PANEL(GxEPD2_750_YT7, 800, 480)
+GXEPD2_SHIM_PANEL(GxEPD2_420, 400, 300)
@@ -0,0 +1,81 @@
+#pragma once
+// Host stand-in for GxEPD2_BW: the same paged 1 bpp buffer (set bit = white), but each finished
+// page is copied into a whole-screen frame instead of being sent to a panel
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX
+{
+public:
+    static const uint16_t stride = GxEPD2_Type::WIDTH / 8;
+
+    GxEPD2_BW(GxEPD2_Type) : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), pageTop(0)
+    {
+        memset(frame, 0xFF, sizeof(frame));
+    }
+
+    void init(uint32_t serial_diag_bitrate = 0, bool initial = true, uint16_t reset_duration = 10, bool pulldown_rst_mode = false) {}
+    void setFullWindow() {}
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {}
+    void hibernate() {}
+    void powerOff() {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || x >= _width || y < pageTop || y >= pageTop + (int16_t)page_height || y >= _height)
+            return;
+        uint8_t &target = buffer[(y - pageTop) * stride + x / 8];
+        uint8_t bit = 1 << (7 - x % 8);
+        target = color ? target | bit : target & ~bit;
+    }
+
+    void fillScreen(uint16_t color) override
+    {
+        memset(buffer, color ? 0xFF : 0x00, sizeof(buffer));
+    }
+
+    void firstPage()
+    {
+        pageTop = 0;
+        fillScreen(GxEPD_WHITE);
+    }
+
+    bool nextPage()
+    {
+        uint16_t rows = min((int)page_height, _height - pageTop);
+        memcpy(frame + pageTop * stride, buffer, rows * stride);
+        pageTop += page_height;
+        if (pageTop >= _height)
+        {
+            pageTop = 0;
+            return false;
+        }
+        fillScreen(GxEPD_WHITE);
+        return true;
+    }
+
+    // Bypasses the page buffer like the real one, writing straight into the "panel"
+    void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+        for (int16_t row = 0; row < h; row++)
+        {
+            for (int16_t b = 0; b < w / 8; b++)
+            {
+                uint8_t data = bitmap[row * (w / 8) + b];
+                frame[(y + row) * stride + x / 8 + b] = invert ? ~data : data;
+            }
+        }
+    }
+
+    void refresh(bool partial_update_mode = false) {}
+
+    // What the panel would be showing, stride bytes per row
+    const uint8_t *frameBuffer() const { return frame; }
+
+private:
+    uint8_t buffer[stride * page_height];
+    uint8_t frame[stride * GxEPD2_Type::HEIGHT];
+    int16_t pageTop;
+};
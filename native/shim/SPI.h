@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+
+// The render proxy draws into RAM, there is no bus
+class SPIClass
+{
+public:
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+};
+
+static SPIClass SPI;
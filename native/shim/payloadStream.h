@@ -0,0 +1,27 @@
+#pragma once
+// A response body held in memory, read as the network stream the forecast decoders take. Used by the
+// host tools that feed them recorded or generated payloads (parse_bench, fuzz_decoders)
+#include <Arduino.h>
+#include <string>
+
+class PayloadStream : public Stream
+{
+public:
+    explicit PayloadStream(const std::string &payload) : payload(payload), position(0) { setTimeout(0); }
+
+    int available() override { return payload.size() - position; }
+    int read() override { return position < payload.size() ? (uint8_t)payload[position++] : -1; }
+    int peek() override { return position < payload.size() ? (uint8_t)payload[position] : -1; }
+    size_t readBytes(char *buffer, size_t length) override
+    {
+        length = min(length, payload.size() - position);
+        memcpy(buffer, payload.data() + position, length);
+        position += length;
+        return length;
+    }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    const std::string &payload;
+    size_t position;
+};
@@ -0,0 +1,192 @@
+# Writes the parser corpus in native/corpus: forecast responses in the exact layout DataPoint and
+# OpenWeatherMap send, with seeded values so the files are the same on every run.
+#
+#   python scripts/gen_corpus.py
+#
+# Besides the everyday responses it covers what the services do now and then: DST changeover days,
+# periods without a "Pp", short forecasts, a single Rep sent as an object rather than an array, more
+# periods than the station keeps (maxNumRecords), and bodies cut off mid-transfer. Feed them to
+# the parse benchmark ([env:parse_bench] in platformio.ini) or serve one with
+# scripts/standin_server.py --payload.
+#
+# native/corpus/expected.txt lists the records the station's decoders should get from each file,
+# worked out here independently of them, and parse_bench fails a file that decodes to a different count.
+import datetime
+import json
+import os
+import random
+
+CORPUS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "native", "corpus")
+MAX_RECORDS = 40  # maxNumRecords in include/forecast.h
+
+DATAPOINT_PARAMS = [
+    ("F", "C", "Feels Like Temperature"), ("G", "mph", "Wind Gust"), ("H", "%", "Screen Relative Humidity"),
+    ("T", "C", "Temperature"), ("V", "", "Visibility"), ("D", "compass", "Wind Direction"),
+    ("S", "mph", "Wind Speed"), ("U", "", "Max UV Index"), ("W", "", "Weather Type"),
+    ("Pp", "%", "Precipitation Probability"),
+]
+COMPASS = ["N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"]
+VISIBILITY = ["VP", "PO", "MO", "GO", "VG", "EX"]
+
+
+def datapoint_rep(rng, minutes, drop=()):
+    temperature = rng.randint(2, 19)
+    rep = {
+        "D": rng.choice(COMPASS), "F": str(temperature - rng.randint(0, 4)), "G": str(rng.randint(5, 40)),
+        "H": str(rng.randint(55, 98)), "Pp": str(rng.choice([1, 3, 5, 8, 12, 20, 35, 48, 60, 85, 95])),
+        "S": str(rng.randint(2, 25)), "T": str(temperature), "V": rng.choice(VISIBILITY),
+        "W": str(rng.choice([0, 1, 2, 3, 5, 7, 8, 9, 10, 12, 14, 15, 17, 20, 23, 27, 29, 30])),
+        "U": str(rng.randint(0, 4)), "$": str(minutes),
+    }
+    for key in drop:
+        rep.pop(key, None)
+    return rep
+
+
+def datapoint(seed, first_day, days, first_minutes=540, drop_every=0, drop=()):
+    rng = random.Random(seed)
+    periods = []
+    count = 0
+    for d in range(days):
+        day = first_day + datetime.timedelta(days=d)
+        reps = []
+        for minutes in range(first_minutes if d == 0 else 0, 1440, 180):
+            count += 1
+            reps.append(datapoint_rep(rng, minutes, drop if drop_every and count % drop_every == 0 else ()))
+        periods.append({"type": "Day", "value": day.strftime("%Y-%m-%dZ"), "Rep": reps})
+    return {"SiteRep": {
+        "Wx": {"Param": [{"name": n, "units": u, "$": text} for n, u, text in DATAPOINT_PARAMS]},
+        "DV": {"dataDate": first_day.strftime("%Y-%m-%dT09:00:00Z"), "type": "Forecast",
+               "Location": {"i": "350759", "lat": "51.4813", "lon": "-3.1805", "name": "CARDIFF",
+                            "country": "WALES", "continent": "EUROPE", "elevation": "9.0", "Period": periods}}}}
+
+
+OWM_CONDITIONS = [
+    (800, "Clear", "clear sky", "01"), (801, "Clouds", "few clouds", "02"), (802, "Clouds", "scattered clouds", "03"),
+    (804, "Clouds", "overcast clouds", "04"), (521, "Rain", "shower rain", "09"), (500, "Rain", "light rain", "10"),
+    (211, "Thunderstorm", "thunderstorm", "11"), (601, "Snow", "snow", "13"), (741, "Fog", "fog", "50"),
+]
+
+
+def owm_weather_list(rng, night, count):
+    entries = []
+    for _ in range(count):
+        code, main, description, icon = rng.choice(OWM_CONDITIONS)
+        entries.append({"id": code, "main": main, "description": description, "icon": icon + ("n" if night else "d")})
+    return entries
+
+
+def owm_main(rng):
+    temperature = round(rng.uniform(2, 19), 2)
+    return {"temp": temperature, "feels_like": round(temperature - rng.uniform(0, 3), 2),
+            "temp_min": round(temperature - rng.uniform(0, 2), 2), "temp_max": round(temperature + rng.uniform(0, 2), 2),
+            "pressure": rng.randint(995, 1030), "sea_level": rng.randint(995, 1030), "grnd_level": rng.randint(990, 1025),
+            "humidity": rng.randint(55, 98), "temp_kf": 0}
+
+
+def owm_weather(seed):
+    rng = random.Random(seed)
+    return {"coord": {"lon": -3.18, "lat": 51.48}, "weather": owm_weather_list(rng, False, 2), "base": "stations",
+            "main": owm_main(rng), "visibility": 10000, "wind": {"speed": 5.14, "deg": 230, "gust": 9.26},
+            "rain": {"1h": 0.31}, "clouds": {"all": 75}, "dt": 1792400000,
+            "sys": {"type": 2, "id": 2019146, "country": "GB", "sunrise": 1792393380, "sunset": 1792431120},
+            "timezone": 3600, "id": 2653822, "name": "Cardiff", "cod": 200}
+
+
+def owm_forecast(seed, count, precipitation=True):
+    rng = random.Random(seed)
+    start = 1792411200  # a 12:00 UTC slot
+    entries = []
+    for i in range(count):
+        dt = start + i * 10800
+        night = datetime.datetime.utcfromtimestamp(dt).hour in (0, 3, 21)
+        entry = {"dt": dt, "main": owm_main(rng), "weather": owm_weather_list(rng, night, rng.choice([1, 1, 2])),
+                 "clouds": {"all": rng.randint(0, 100)},
+                 "wind": {"speed": round(rng.uniform(1, 12), 2), "deg": rng.randint(0, 359), "gust": round(rng.uniform(2, 20), 2)},
+                 "visibility": 10000, "pop": round(rng.random(), 2), "sys": {"pod": "n" if night else "d"},
+                 "dt_txt": datetime.datetime.utcfromtimestamp(dt).strftime("%Y-%m-%d %H:%M:%S")}
+        if precipitation and entry["pop"] > 0.3:
+            entry["rain"] = {"3h": round(rng.uniform(0.1, 4), 2)}
+        entries.append(entry)
+    return {"cod": "200", "message": 0, "cnt": count, "list": entries,
+            "city": {"id": 2653822, "name": "Cardiff", "coord": {"lat": 51.48, "lon": -3.18}, "country": "GB",
+                     "population": 302139, "timezone": 3600, "sunrise": 1792393380, "sunset": 1792431120}}
+
+
+def expected_records(text):
+    """Records the decoders keep from a body: they read the periods' array one element at a time, so
+    everything is lost when an element is cut off, but a body cut between elements keeps those read."""
+    datapoint = '"SiteRep"' in text
+    start = text.find('"Period":[' if datapoint else '"list":[')
+    if start < 0:
+        return 0
+    position = text.index("[", start) + 1
+    decoder = json.JSONDecoder()
+    records = 0
+    while True:
+        try:
+            element, position = decoder.raw_decode(text, position)
+        except ValueError:
+            return 0
+        if datapoint:
+            reps = element.get("Rep", [])
+            records += 1 if isinstance(reps, dict) else len(reps)
+        else:
+            records += 1
+        if records >= MAX_RECORDS:
+            return MAX_RECORDS
+        if text[position:position + 1] != ",":
+            return records
+        position += 1
+
+
+def write(expected, name, document, truncate=None):
+    text = json.dumps(document, separators=(",", ":"))
+    if truncate is not None:
+        text = text[:int(len(text) * truncate)]
+    path = os.path.join(CORPUS, name)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(text)
+    expected[name] = expected_records(text)
+    print("%s: %d bytes, %d records" % (name, len(text), expected[name]))
+
+
+def main():
+    expected = {}
+    autumn = datetime.date(2026, 10, 23)  # clocks go back on Sunday 25 October 2026
+    spring = datetime.date(2027, 3, 26)   # and forward on Sunday 28 March 2027
+    normal = datapoint(1, autumn - datetime.timedelta(days=4), 5)
+
+    write(expected, "datapoint/normal.json", normal)
+    write(expected, "datapoint/dst_autumn.json", datapoint(2, autumn, 5))
+    write(expected, "datapoint/dst_spring.json", datapoint(3, spring, 5))
+    write(expected, "datapoint/midnight_start.json", datapoint(4, autumn, 5, first_minutes=0))
+    write(expected, "datapoint/missing_pp.json", datapoint(5, autumn, 5, drop_every=3, drop=("Pp",)))
+    write(expected, "datapoint/missing_fields.json", datapoint(6, autumn, 5, drop_every=2, drop=("T", "W", "$")))
+    write(expected, "datapoint/few_periods.json", datapoint(7, autumn, 1, first_minutes=1080))
+
+    single = datapoint(8, autumn, 1, first_minutes=1260)  # DataPoint sends a lone Rep as an object
+    period = single["SiteRep"]["DV"]["Location"]["Period"][0]
+    period["Rep"] = period["Rep"][0]
+    write(expected, "datapoint/single_rep_object.json", single)
+
+    write(expected, "datapoint/oversized.json", datapoint(9, autumn, 8, first_minutes=0))  # 64 periods, past maxNumRecords
+    write(expected, "datapoint/truncated.json", normal, truncate=0.6)
+    write(expected, "datapoint/empty_location.json", {"SiteRep": {"Wx": {"Param": []}, "DV": {"dataDate": "2026-10-19T09:00:00Z",
+                                                                                   "type": "Forecast", "Location": {}}}})
+
+    write(expected, "owm/weather.json", owm_weather(10))
+    write(expected, "owm/forecast.json", owm_forecast(11, 40))
+    write(expected, "owm/forecast_short.json", owm_forecast(12, 8))
+    write(expected, "owm/forecast_no_precipitation.json", owm_forecast(13, 40, precipitation=False))
+    write(expected, "owm/forecast_truncated.json", owm_forecast(14, 40), truncate=0.5)
+
+    with open(os.path.join(CORPUS, "expected.txt"), "w") as f:
+        f.write("# file, records the station should decode from it; written by scripts/gen_corpus.py\n")
+        for name in sorted(expected):
+            f.write("%s %d\n" % (name, expected[name]))
+
+
+if __name__ == "__main__":
+    main()
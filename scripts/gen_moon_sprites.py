@@ -0,0 +1,172 @@
+# Generates include/moonSprites.h, the pre-rendered moon phases drawn by DrawMoon in src/display.cpp
+#
+# Runs as a PlatformIO pre: script (see platformio.ini) and only rewrites the header when its
+# contents change, or standalone with: python scripts/gen_moon_sprites.py
+#
+# The sprites reproduce the original per-wake drawing pixel for pixel: a filled black disc, white
+# horizontal lines for the lit part, then a black outline, all with the Adafruit GFX algorithms.
+import math
+import os
+
+PHASES = 32       # sprites per lunar cycle, 11.25 degrees each
+DIAMETER = 70     # moon diameter the layout was drawn for
+LINES = 90        # horizontal lines used to shade the lit part
+
+# The disc is centred on (DIAMETER - 1, DIAMETER) from the DrawMoon anchor, radius DIAMETER / 2 + 1
+CENTRE_X = DIAMETER - 1
+CENTRE_Y = DIAMETER
+RADIUS = DIAMETER // 2 + 1
+ORIGIN_X = CENTRE_X - RADIUS  # sprite position relative to the DrawMoon anchor
+ORIGIN_Y = CENTRE_Y - RADIUS
+SIZE = 2 * RADIUS + 1
+
+
+class Canvas:
+    def __init__(self):
+        self.pixels = [[False] * SIZE for _ in range(SIZE)]
+
+    def pixel(self, x, y, black):
+        x -= ORIGIN_X
+        y -= ORIGIN_Y
+        if 0 <= x < SIZE and 0 <= y < SIZE:
+            self.pixels[y][x] = black
+
+    def vline(self, x, y, h, black):
+        for i in range(h):
+            self.pixel(x, y + i, black)
+
+    def hline(self, x0, x1, y, black):
+        if x0 > x1:
+            x0, x1 = x1, x0
+        for x in range(x0, x1 + 1):
+            self.pixel(x, y, black)
+
+    def fill_circle(self, x0, y0, r):
+        # Adafruit_GFX::fillCircle and fillCircleHelper(corners = 3, delta = 0)
+        self.vline(x0, y0 - r, 2 * r + 1, True)
+        f, ddf_x, ddf_y, x, y = 1 - r, 1, -2 * r, 0, r
+        px, py, delta = x, y, 1
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if x < y + 1:
+                self.vline(x0 + x, y0 - y, 2 * y + delta, True)
+                self.vline(x0 - x, y0 - y, 2 * y + delta, True)
+            if y != py:
+                self.vline(x0 + py, y0 - px, 2 * px + delta, True)
+                self.vline(x0 - py, y0 - px, 2 * px + delta, True)
+                py = y
+            px = x
+
+    def circle(self, x0, y0, r):
+        # Adafruit_GFX::drawCircle
+        f, ddf_x, ddf_y, x, y = 1 - r, 1, -2 * r, 0, r
+        for dx, dy in ((0, r), (0, -r), (r, 0), (-r, 0)):
+            self.pixel(x0 + dx, y0 + dy, True)
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            for dx, dy in ((x, y), (-x, y), (x, -y), (-x, -y), (y, x), (-y, x), (y, -x), (-y, -x)):
+                self.pixel(x0 + dx, y0 + dy, True)
+
+
+# The original added the anchor in double precision and truncated to int16_t, which rounds
+# differently right at pixel boundaries; do the same with the anchors the layout uses
+ANCHOR_X = 157
+ANCHOR_Y = 90
+
+
+def to_pixel(value, anchor):
+    return int(value + anchor) - anchor
+
+
+def render(phase):
+    canvas = Canvas()
+    canvas.fill_circle(CENTRE_X, CENTRE_Y, RADIUS)
+    y_pos = 0.0
+    while y_pos <= LINES // 2:
+        x_pos = math.sqrt(LINES // 2 * LINES // 2 - y_pos * y_pos)
+        r_pos = 2 * x_pos
+        if phase < 0.5:
+            x_pos1 = -x_pos
+            x_pos2 = r_pos - 2 * phase * r_pos - x_pos
+        else:
+            x_pos1 = x_pos
+            x_pos2 = x_pos - 2 * phase * r_pos + r_pos
+        x1 = to_pixel((x_pos1 + LINES) / LINES * DIAMETER, ANCHOR_X)
+        x2 = to_pixel((x_pos2 + LINES) / LINES * DIAMETER, ANCHOR_X)
+        y_top = to_pixel((LINES - y_pos) / LINES * DIAMETER, ANCHOR_Y)
+        y_bottom = to_pixel((y_pos + LINES) / LINES * DIAMETER, ANCHOR_Y)
+        canvas.hline(x1, x2, y_top, False)
+        canvas.hline(x1, x2, y_bottom, False)
+        y_pos += 1
+    canvas.circle(CENTRE_X, CENTRE_Y, DIAMETER // 2)
+    return canvas
+
+
+def pack(canvas):
+    # Adafruit_GFX::drawBitmap layout: rows padded to whole bytes, leftmost pixel in the MSB
+    data = []
+    for row in canvas.pixels:
+        for byte_x in range(0, SIZE, 8):
+            byte = 0
+            for bit in range(8):
+                x = byte_x + bit
+                if x < SIZE and row[x]:
+                    byte |= 0x80 >> bit
+            data.append(byte)
+    return data
+
+
+def generate():
+    lines = [
+        "// Generated by scripts/gen_moon_sprites.py, do not edit",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "const int MoonSpritePhases = %d;" % PHASES,
+        "const int MoonSpriteSize = %d; // pixels square" % SIZE,
+        "const int MoonSpriteOffsetX = %d; // from the DrawMoon anchor" % ORIGIN_X,
+        "const int MoonSpriteOffsetY = %d;" % ORIGIN_Y,
+        "",
+        "// 1 bpp, black pixels set; sprite i is the moon at phase angle i * 360 / MoonSpritePhases degrees",
+        "const unsigned char MoonSprites[MoonSpritePhases][%d] PROGMEM = {" % (((SIZE + 7) // 8) * SIZE),
+    ]
+    for i in range(PHASES):
+        angle = i * 360.0 / PHASES
+        data = pack(render((angle + 180) / 360))
+        lines.append("  { // %.2f degrees" % angle)
+        for start in range(0, len(data), 20):
+            lines.append("    " + ", ".join("0x%02x" % b for b in data[start:start + 20]) + ",")
+        lines.append("  },")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as existing:
+            if existing.read() == text:
+                return
+    with open(path, "w") as out:
+        out.write(text)
+    print("Generated " + path)
+
+
+try:
+    Import("env")  # noqa: F821, provided when run by PlatformIO
+    project_dir = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    project_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+write_if_changed(os.path.join(project_dir, "include", "moonSprites.h"), generate())
@@ -0,0 +1,99 @@
+# Batch renderer: draws every site's screen in one go, for pre-rendering a whole fleet
+#
+# One host renderer in --batch mode (pio run -e render_proxy) draws the sites on its own pool of
+# threads, each with its own frame buffer and U8g2 state. Forecasts go to it down stdin and frames
+# come back up stdout, so no file is written until the finished frames. Forecasts are fetched on
+# several threads here and handed over in time zone order, since the renderer can only draw one
+# zone at a time. Writes one gzipped 1 bpp frame per site:
+#
+#   python scripts/render_fleet.py --sites sites.json --apikey KEY --out frames/
+#
+# sites.json is the same list render_proxy.py takes; --payload renders every site from a recorded
+# DataPoint response, which is also the way to benchmark the renderer on its own.
+import argparse
+import concurrent.futures
+import gzip
+import json
+import os
+import subprocess
+import threading
+import time
+
+from render_proxy import DEFAULT_RENDERER, FRAME_BYTES, fetch_forecast
+
+DEFAULT_TIMEZONE = "GMT0BST,M3.5.0/01,M10.5.0/02"
+
+
+def feed(renderer, sites, apikey, payload, fetchers, now, failed):
+    """Writes each site's job to the renderer's stdin, fetching forecasts on fetchers threads."""
+    def fetch(site):
+        try:
+            return fetch_forecast(site, apikey, payload)
+        except (OSError, ValueError) as error:
+            failed.append((site["site"], "fetch: %s" % error))
+            return None
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=fetchers) as pool:
+        for site, forecast in zip(sites, pool.map(fetch, sites)):  # in order, so zones stay together
+            if forecast is None:
+                continue
+            renderer.stdin.write(("%s %s %s %d %s %d\n" % (site["site"], site["latitude"], site["longitude"], int(now),
+                                                           site.get("timezone", DEFAULT_TIMEZONE),
+                                                           len(forecast))).encode())
+            renderer.stdin.write(forecast)
+            renderer.stdin.flush()
+    renderer.stdin.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Render every site's screen in parallel")
+    parser.add_argument("--sites", required=True, help="JSON list of sites, as for render_proxy.py")
+    parser.add_argument("--apikey", default=os.environ.get("DATAPOINT_API_KEY", ""), help="DataPoint API key")
+    parser.add_argument("--payload", help="recorded DataPoint response to use for every site")
+    parser.add_argument("--renderer", default=DEFAULT_RENDERER, help="host renderer built by pio run -e render_proxy")
+    parser.add_argument("--out", required=True, help="directory for the <site>.bin.gz frames")
+    parser.add_argument("--threads", type=int, default=os.cpu_count() or 1, help="renderer threads")
+    parser.add_argument("--fetchers", type=int, default=8, help="forecasts fetched at once")
+    args = parser.parse_args()
+
+    with open(args.sites) as f:
+        sites = json.load(f)
+    sites.sort(key=lambda site: site.get("timezone", DEFAULT_TIMEZONE))
+    os.makedirs(args.out, exist_ok=True)
+
+    now = time.time()
+    started = time.perf_counter()
+    renderer = subprocess.Popen([args.renderer, "--batch", str(max(1, args.threads))], stdin=subprocess.PIPE,
+                                stdout=subprocess.PIPE)
+    failed = []
+    feeder = threading.Thread(target=feed, args=(renderer, sites, args.apikey, args.payload, args.fetchers, now, failed),
+                              daemon=True)
+    feeder.start()
+
+    rendered = 0
+    render_micros = 0
+    for line in renderer.stdout:
+        fields = line.decode().split()
+        if len(fields) == 3 and fields[1] == "ok":
+            frame = renderer.stdout.read(FRAME_BYTES)
+            if len(frame) != FRAME_BYTES:
+                failed.append((fields[0], "renderer sent %d bytes, expected %d" % (len(frame), FRAME_BYTES)))
+                break
+            with open(os.path.join(args.out, "%s.bin.gz" % fields[0]), "wb") as f:
+                f.write(gzip.compress(frame, compresslevel=9))
+            rendered += 1
+            render_micros += int(fields[2])
+        else:
+            failed.append((fields[0] if fields else "?", "renderer replied %r" % line.decode().strip()))
+    feeder.join()
+    renderer.wait()
+    elapsed = time.perf_counter() - started
+
+    for site, error in failed:
+        print("%s: %s" % (site, error))
+    print("%d of %d sites rendered in %.2f s with %d threads, %.1f sites/s, %.1f ms per render" % (
+        rendered, len(sites), elapsed, args.threads, rendered / elapsed, render_micros / 1000 / max(1, rendered)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+# Render proxy for thin client stations (firmware built with -D THIN_CLIENT)
+#
+# Fetches each site's forecast once, draws the station's 800x480 screen with the firmware's own
+# display code built for the host (pio run -e render_proxy), and serves the 1 bpp frame gzipped with
+# an ETag. A station whose ETag still matches gets a 304 and goes straight back to sleep.
+#
+#   python scripts/render_proxy.py --sites sites.json --apikey KEY --port 8080
+#
+# sites.json lists the stations, e.g.
+#   [{"site": "home", "location": 350759, "latitude": 51.48, "longitude": -3.18,
+#     "timezone": "GMT0BST,M3.5.0/01,M10.5.0/02"}]
+#
+# --payload serves every site from a recorded DataPoint response instead of the live API.
+import argparse
+import gzip
+import hashlib
+import http.server
+import json
+import os
+import subprocess
+import tempfile
+import threading
+import time
+import urllib.parse
+import urllib.request
+
+DATAPOINT_URL = "http://datapoint.metoffice.gov.uk/public/data/val/wxfcs/all/json/%s?res=3hourly&key=%s"
+FRAME_BYTES = 800 // 8 * 480
+DEFAULT_RENDERER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".pio", "build", "render_proxy", "program")
+
+
+def fetch_forecast(site, apikey, payload):
+    if payload is not None:
+        with open(payload, "rb") as f:
+            return f.read()
+    with urllib.request.urlopen(DATAPOINT_URL % (site["location"], apikey), timeout=30) as response:
+        return response.read()
+
+
+def render_frame(renderer, site, forecast, now):
+    with tempfile.TemporaryDirectory() as work:
+        forecast_path = os.path.join(work, "forecast.json")
+        frame_path = os.path.join(work, "frame.bin")
+        with open(forecast_path, "wb") as f:
+            f.write(forecast)
+        subprocess.run([renderer, forecast_path, str(site["latitude"]), str(site["longitude"]), str(int(now)),
+                        site.get("timezone", "GMT0BST,M3.5.0/01,M10.5.0/02"), frame_path],
+                       check=True, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        with open(frame_path, "rb") as f:
+            frame = f.read()
+    if len(frame) != FRAME_BYTES:
+        raise ValueError("renderer wrote %d bytes, expected %d" % (len(frame), FRAME_BYTES))
+    return frame
+
+
+class FrameCache:
+    """The latest rendered frame per site, re-rendered once it is older than max_age seconds."""
+
+    def __init__(self, sites, renderer, apikey, payload, max_age):
+        self.sites = {site["site"]: site for site in sites}
+        self.renderer = renderer
+        self.apikey = apikey
+        self.payload = payload
+        self.max_age = max_age
+        self.frames = {}  # site -> (rendered at, etag, gzipped frame)
+        self.locks = {name: threading.Lock() for name in self.sites}
+
+    def get(self, name):
+        if name not in self.sites:
+            return None
+        with self.locks[name]:  # one render per site however many stations ask at once
+            cached = self.frames.get(name)
+            now = time.time()
+            if cached is None or now - cached[0] > self.max_age:
+                site = self.sites[name]
+                frame = render_frame(self.renderer, site, fetch_forecast(site, self.apikey, self.payload), now)
+                etag = '"%s"' % hashlib.sha1(frame).hexdigest()[:16]
+                cached = (now, etag, gzip.compress(frame, compresslevel=9))
+                self.frames[name] = cached
+                print("%s: rendered, %d bytes gzipped, etag %s" % (name, len(cached[2]), etag))
+            return cached
+
+
+def make_handler(cache):
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.0"
+
+        def do_GET(self):
+            url = urllib.parse.urlparse(self.path)
+            site = urllib.parse.parse_qs(url.query).get("site", [""])[0]
+            if url.path != "/frame":
+                self.send_error(404)
+                return
+            try:
+                cached = cache.get(site)
+            except (OSError, ValueError, subprocess.CalledProcessError) as error:
+                self.log_message("%s: render failed: %s", site, error)
+                self.send_error(502)
+                return
+            if cached is None:
+                self.send_error(404, "unknown site")
+                return
+
+            _, etag, body = cached
+            if self.headers.get("If-None-Match") == etag:
+                self.send_response(304)
+                self.send_header("ETag", etag)
+                self.end_headers()
+                return
+            self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Encoding", "gzip")
+            self.send_header("Content-Length", str(len(body)))
+            self.send_header("ETag", etag)
+            self.end_headers()
+            self.wfile.write(body)
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve pre-rendered screens to thin client stations")
+    parser.add_argument("--sites", required=True, help="JSON list of sites, see the top of this file")
+    parser.add_argument("--apikey", default=os.environ.get("DATAPOINT_API_KEY", ""), help="DataPoint API key")
+    parser.add_argument("--payload", help="recorded DataPoint response to use for every site")
+    parser.add_argument("--renderer", default=DEFAULT_RENDERER, help="host renderer built by pio run -e render_proxy")
+    parser.add_argument("--max-age", type=int, default=30 * 60, help="seconds before a site is re-rendered")
+    parser.add_argument("--port", type=int, default=8080)
+    args = parser.parse_args()
+
+    with open(args.sites) as f:
+        sites = json.load(f)
+
+    cache = FrameCache(sites, args.renderer, args.apikey, args.payload, args.max_age)
+    server = http.server.ThreadingHTTPServer(("", args.port), make_handler(cache))
+    print("Serving %d sites on port %d" % (len(sites), args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
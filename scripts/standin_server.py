@@ -0,0 +1,66 @@
+# Stand-in for the forecast API (DataPoint or OpenWeatherMap), for testing the firmware without the real service
+#
+# Serves a recorded forecast response for every GET, gzip compressed when the request says it
+# accepts gzip (see RequestGzip in include/constants.h). Point the station at it by setting
+# forecastHost / forecastPort in include/constants.h to this machine, then run e.g.:
+#
+#   python scripts/standin_server.py --payload forecast.json --port 8080
+#
+# --window-bits compresses with a smaller deflate window, to match a firmware built with a smaller
+# GZIP_WINDOW_BITS; --no-gzip serves plain JSON whatever the request asks for.
+import argparse
+import gzip
+import http.server
+import zlib
+
+
+def gzip_body(data, window_bits):
+    if window_bits == 15:
+        return gzip.compress(data, compresslevel=9)
+    # adding 16 to the window bits makes zlib write a gzip header and trailer
+    compressor = zlib.compressobj(9, zlib.DEFLATED, 16 + window_bits)
+    return compressor.compress(data) + compressor.flush()
+
+
+def make_handler(payload, window_bits, allow_gzip):
+    compressed = gzip_body(payload, window_bits)
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.0"
+
+        def do_GET(self):
+            accepts = self.headers.get("Accept-Encoding", "")
+            use_gzip = allow_gzip and "gzip" in accepts
+            body = compressed if use_gzip else payload
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            if use_gzip:
+                self.send_header("Content-Encoding", "gzip")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+            self.log_message("%s: %d bytes%s (%d uncompressed)", self.path.split("?")[0], len(body),
+                             " gzip" if use_gzip else "", len(payload))
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve a recorded forecast response, optionally gzipped")
+    parser.add_argument("--payload", required=True, help="recorded DataPoint JSON response to serve")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--window-bits", type=int, default=15, choices=range(9, 16))
+    parser.add_argument("--no-gzip", action="store_true", help="never compress the response")
+    args = parser.parse_args()
+
+    with open(args.payload, "rb") as f:
+        payload = f.read()
+
+    handler = make_handler(payload, args.window_bits, not args.no_gzip)
+    server = http.server.ThreadingHTTPServer(("", args.port), handler)
+    print("Serving %s on port %d" % (args.payload, args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,6 @@
+# Builds a native environment with clang instead of the host's default compiler, for libFuzzer
+# ([env:fuzz_decoders] in platformio.ini), which only clang provides
+Import("env")
+
+env.Replace(CC="clang", CXX="clang++", LINK="clang++")
+env.Append(LINKFLAGS=["-fsanitize=fuzzer,address"])
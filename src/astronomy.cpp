@@ -0,0 +1,100 @@
+#include <Arduino.h>
+#include <astronomy.h>
+
+#include <moonPhase.h>
+
+#ifdef ARDUINO
+// Sunrise, sunset and the moon only change once a day, so the station keeps them across deep sleep
+RTC_DATA_ATTR static astronomyDay cachedDay;
+RTC_DATA_ATTR static bool cachedDayValid = false;
+#endif
+
+// converts minutes after UTC midnight on a date to local minutes after midnight using the TZ rules
+static int UtcMinutesToLocal(long day, int utcMinutes)
+{
+    time_t when = day * 86400L + utcMinutes * 60L;
+    struct tm local;
+    localtime_r(&when, &local);
+    return local.tm_hour * 60 + local.tm_min;
+}
+
+// Sunrise and sunset in UTC minutes for a run of days, using the NOAA low precision solar
+// position equations (within three minutes of the full NOAA calculation up to 52 degrees, five at 60). It is a straight pass
+// over the days in single precision, which the ESP32 FPU does in hardware, so the whole
+// horizon costs about as much as one SunSet calculation in double precision. test/test_astronomy
+// checks it against SunSet over a year of dates and several latitudes.
+void CalculateSunTimes(long firstDay, int numDays, float latitude, float longitude, int16_t sunriseUtc[], int16_t sunsetUtc[])
+{
+    const float degToRad = PI / 180.0f;
+    const float cosZenith = -0.01454f; // cos(90.833 deg): refraction and the sun's radius
+    const float sinLat = sinf(latitude * degToRad);
+    const float cosLat = cosf(latitude * degToRad);
+
+    // day of the year of firstDay, counted from the 1st of January
+    time_t first = firstDay * 86400L;
+    struct tm date;
+    gmtime_r(&first, &date);
+    const float yearDays = (date.tm_year % 4 == 0) ? 366.0f : 365.0f;
+
+    for (int i = 0; i < numDays; i++)
+    {
+        float gamma = 2.0f * PI / yearDays * (date.tm_yday + i); // fractional year at noon, wrapping is harmless
+        float eqTime = 229.18f * (0.000075f + 0.001868f * cosf(gamma) - 0.032077f * sinf(gamma) -
+                                  0.014615f * cosf(2 * gamma) - 0.040849f * sinf(2 * gamma));
+        float decl = 0.006918f - 0.399912f * cosf(gamma) + 0.070257f * sinf(gamma) - 0.006758f * cosf(2 * gamma) +
+                     0.000907f * sinf(2 * gamma) - 0.002697f * cosf(3 * gamma) + 0.00148f * sinf(3 * gamma);
+
+        float cosHourAngle = (cosZenith - sinLat * sinf(decl)) / (cosLat * cosf(decl));
+        cosHourAngle = constrain(cosHourAngle, -1.0f, 1.0f); // midnight sun or polar night
+        float hourAngle = acosf(cosHourAngle) / degToRad;
+
+        sunriseUtc[i] = (int16_t)(720 - 4 * (longitude + hourAngle) - eqTime);
+        sunsetUtc[i] = (int16_t)(720 - 4 * (longitude - hourAngle) - eqTime);
+    }
+}
+
+static void CalculateAstronomy(astronomyDay &day, tm *timeNow, double latitude, double longitude)
+{
+    int year = timeNow->tm_year + 1900;
+    int month = timeNow->tm_mon + 1;
+    long today = DaysFromCivil(year, month, timeNow->tm_mday);
+
+    int16_t sunriseUtc[AstronomyHorizonDays], sunsetUtc[AstronomyHorizonDays];
+    CalculateSunTimes(today, AstronomyHorizonDays, latitude, longitude, sunriseUtc, sunsetUtc);
+    for (int i = 0; i < AstronomyHorizonDays; i++)
+    {
+        day.horizonSunrise[i] = UtcMinutesToLocal(today + i, sunriseUtc[i]);
+        day.horizonSunset[i] = UtcMinutesToLocal(today + i, sunsetUtc[i]);
+    }
+    day.sunrise = day.horizonSunrise[0];
+    day.sunset = day.horizonSunset[0];
+
+    struct tm renderTime = *timeNow; // mktime normalises its argument
+    moonPhase moonPhase;
+    moonData_t moon = moonPhase.getPhase(mktime(&renderTime)); // the moon at the time being drawn, not the clock's
+    day.moonAngle = moon.angle;
+    day.moonPercentLit = moon.percentLit;
+
+    day.year = timeNow->tm_year;
+    day.yearDay = timeNow->tm_yday;
+    day.day = today;
+    day.latitude = latitude;
+    day.longitude = longitude;
+}
+
+void GetAstronomy(astronomyDay &day, tm *timeNow, double latitude, double longitude)
+{
+#ifdef ARDUINO
+    if (!cachedDayValid || cachedDay.year != timeNow->tm_year || cachedDay.yearDay != timeNow->tm_yday ||
+        cachedDay.latitude != (float)latitude || cachedDay.longitude != (float)longitude)
+    {
+        CalculateAstronomy(cachedDay, timeNow, latitude, longitude);
+        cachedDayValid = true;
+        Serial.println("Astronomy recalculated for today");
+    }
+    day = cachedDay;
+#else
+    // the host draws many stations' screens, several at once, so it keeps nothing between them
+    CalculateAstronomy(day, timeNow, latitude, longitude);
+#endif
+}
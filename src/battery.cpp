@@ -0,0 +1,122 @@
+#include <Arduino.h>
+#include <battery.h>
+
+// Battery sense: LiPo via a resistor divider onto an ADC1 pin (ADC2 is unusable while WiFi is on)
+static const uint8_t BATTERY_PIN = 35;
+static const float BatteryDividerRatio = 2.0; // e.g. 100k/100k divider
+static const float BatteryCalibration = 1.0;  // trim against a multimeter reading if needed
+static const int BatterySamples = 32;         // oversample to average out ADC noise
+static const float BatteryPresentVoltage = 1.0; // anything below this means no battery fitted (USB powered)
+
+// Battery history survives deep sleep so a discharge curve can be fitted from it
+static const int BatteryHistorySize = 96;
+
+typedef struct
+{
+    uint32_t time;      // unix time of the reading
+    uint16_t milliVolts;
+} batteryLogEntry;
+
+RTC_DATA_ATTR static batteryLogEntry batteryHistory[BatteryHistorySize];
+RTC_DATA_ATTR static int batteryHistoryNext = 0;
+RTC_DATA_ATTR static int batteryHistoryCount = 0;
+RTC_DATA_ATTR static batteryState lastBatteryState = BATTERY_NORMAL;
+
+float ReadBatteryVoltage()
+{
+    analogSetPinAttenuation(BATTERY_PIN, ADC_11db);
+
+    // analogReadMilliVolts applies the factory eFuse ADC calibration
+    uint32_t total = 0;
+    for (int i = 0; i < BatterySamples; i++)
+    {
+        total += analogReadMilliVolts(BATTERY_PIN);
+    }
+
+    float voltage = (float)total / BatterySamples / 1000.0 * BatteryDividerRatio * BatteryCalibration;
+
+    Serial.print("Battery voltage: ");
+    Serial.println(voltage, 3);
+    return voltage;
+}
+
+batteryState UpdateBatteryState(float voltage, const batteryThresholds &thresholds)
+{
+    batteryState state = lastBatteryState;
+
+    if (voltage < BatteryPresentVoltage)
+    {
+        state = BATTERY_NORMAL; // no battery, running off USB
+    }
+    else
+    {
+        // step down immediately, step back up only once clear of the hysteresis band
+        switch (lastBatteryState)
+        {
+        case BATTERY_NORMAL:
+            if (voltage < thresholds.criticalVoltage)
+                state = BATTERY_CRITICAL;
+            else if (voltage < thresholds.lowVoltage)
+                state = BATTERY_LOW;
+            break;
+        case BATTERY_LOW:
+            if (voltage < thresholds.criticalVoltage)
+                state = BATTERY_CRITICAL;
+            else if (voltage > thresholds.lowVoltage + thresholds.hysteresis)
+                state = BATTERY_NORMAL;
+            break;
+        case BATTERY_CRITICAL:
+            if (voltage > thresholds.lowVoltage + thresholds.hysteresis)
+                state = BATTERY_NORMAL;
+            else if (voltage > thresholds.criticalVoltage + thresholds.hysteresis)
+                state = BATTERY_LOW;
+            break;
+        }
+    }
+
+    if (state != lastBatteryState)
+    {
+        Serial.print("Battery state: ");
+        Serial.print(BatteryStateToString(lastBatteryState));
+        Serial.print(" -> ");
+        Serial.println(BatteryStateToString(state));
+    }
+    lastBatteryState = state;
+    return state;
+}
+
+const char *BatteryStateToString(batteryState state)
+{
+    switch (state)
+    {
+    case BATTERY_NORMAL:
+        return "normal";
+    case BATTERY_LOW:
+        return "low";
+    case BATTERY_CRITICAL:
+        return "critical";
+    default:
+        return "";
+    }
+}
+
+void LogBatteryVoltage(float voltage, time_t when)
+{
+    batteryHistory[batteryHistoryNext].time = (uint32_t)when;
+    batteryHistory[batteryHistoryNext].milliVolts = (uint16_t)(voltage * 1000);
+    batteryHistoryNext = (batteryHistoryNext + 1) % BatteryHistorySize;
+    if (batteryHistoryCount < BatteryHistorySize)
+        batteryHistoryCount++;
+}
+
+// dumps the log oldest first as csv, ready to paste into a spreadsheet for fitting
+void PrintBatteryHistory()
+{
+    Serial.println("Battery history (time,mV):");
+    int first = (batteryHistoryNext - batteryHistoryCount + BatteryHistorySize) % BatteryHistorySize;
+    for (int i = 0; i < batteryHistoryCount; i++)
+    {
+        const batteryLogEntry &entry = batteryHistory[(first + i) % BatteryHistorySize];
+        Serial.printf("%u,%u\n", entry.time, entry.milliVolts);
+    }
+}
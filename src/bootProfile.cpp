@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_sleep.h>
+#include <esp32/rtc.h>
+#include <bootProfile.h>
+
+// Both are zero-initialised in .bss, so they are valid before any constructor has run
+static int64_t constructorsStartMicros = 0;
+static int64_t setupStartMicros = 0;
+static uint64_t setupRtcMicros = 0;
+
+// The RTC counter keeps running through deep sleep and the boot after it, unlike esp_timer, which
+// starts with the app. When the last wake went to sleep and the timer woke this one, the RTC time
+// from going to sleep to setup(), less the sleep itself, is the whole boot; what esp_timer has not
+// seen of that is the ROM and second stage bootloader.
+RTC_DATA_ATTR static uint64_t sleepStartRtcMicros = 0;
+RTC_DATA_ATTR static uint64_t plannedSleepMicros = 0;
+
+// Priority 101 is the earliest available to user code, so this runs ahead of every global
+// constructor left at the default priority. esp_timer counts from early in the IDF startup
+// code, after the bootloader has handed over.
+__attribute__((constructor(101))) static void MarkConstructorsStart()
+{
+    constructorsStartMicros = esp_timer_get_time();
+}
+
+void MarkSetupStart()
+{
+    setupStartMicros = esp_timer_get_time();
+    setupRtcMicros = esp_rtc_get_time_us();
+}
+
+void MarkSleepStart(uint64_t sleepMicros)
+{
+    plannedSleepMicros = sleepMicros;
+    sleepStartRtcMicros = esp_rtc_get_time_us();
+}
+
+void PrintBootProfile()
+{
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER && sleepStartRtcMicros != 0)
+    {
+        int64_t bootMicros = (int64_t)(setupRtcMicros - sleepStartRtcMicros - plannedSleepMicros);
+        Serial.printf("Boot: %lld us before app, ", bootMicros - setupStartMicros);
+    }
+    else
+    {
+        Serial.print("Boot: no timed sleep before this one, so the time before the app is unknown; ");
+    }
+    Serial.printf("%lld us to constructors, %lld us constructors to setup(), %lld us since app start\n",
+                  constructorsStartMicros,
+                  setupStartMicros - constructorsStartMicros,
+                  setupStartMicros);
+}
@@ -1,20 +1,23 @@
 #include <Arduino.h>
 #include <weather.h>
+#include <display.h>
 
 #include <SPI.h> // Built-in
-#define ENABLE_GxEPD2_display 1
-#include <GxEPD2_BW.h>
+#include <new>
+#include <panel.h>
 
 #include <U8g2_for_Adafruit_GFX.h>
-#include "epaper_fonts.h"
 #include <weatherSymbols.h>
-#include <common_functions.h>
+#include <moonSprites.h>
+#include <energy.h>
+#include <astronomy.h>
+#include <heapCounter.h>
+#ifdef FRAME_DIFF
+#include <LittleFS.h>
+#include <frameDiff.h>
+#endif
 
-#include <sunset.h>
-#include <moonPhase.h>
-
-#define SCREEN_WIDTH 800 // Set for landscape mode
-#define SCREEN_HEIGHT 480
+#include <layout.h>
 
 enum alignment
 {
@@ -32,27 +35,45 @@ static const uint8_t EPD_SCK = 13;
 static const uint8_t EPD_MISO = 12; // Master-In Slave-Out not used, as no data from display
 static const uint8_t EPD_MOSI = 14;
 
-GxEPD2_BW<GxEPD2_750_T7, GxEPD2_750_T7::HEIGHT> display(GxEPD2_750_T7(/*CS=*/EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RST, /*BUSY=*/EPD_BUSY)); // B/W display
+// Built on first use in InitDisplay rather than by global constructors, so a wake that never
+// reaches the display (no WiFi, no data) doesn't pay for them
+alignas(Panel::displayType) static uint8_t displayStorage[sizeof(Panel::displayType)];
+alignas(renderContext) static uint8_t panelContextStorage[sizeof(renderContext)];
+
+static Panel::displayType *display = NULL; // B/W display
+static renderContext *panelContext = NULL; // draws into display's page buffer
+
+// Hash of the frame on the panel, kept over deep sleep so an unchanged screen is not refreshed again; 0 for unknown
+RTC_DATA_ATTR static uint64_t lastFrameHash = 0;
+// Fingerprint of what that frame was drawn from, so an unchanged forecast is not even drawn; 0 for unknown
+RTC_DATA_ATTR static uint64_t lastSceneFingerprint = 0;
 
-U8G2_FOR_ADAFRUIT_GFX u8g2Fonts;
+void BeginRenderContext(renderContext &context, Adafruit_GFX &target)
+{
+    context.target = &target;
+    context.fonts.begin(target);                   // connect u8g2 procedures to Adafruit GFX
+    context.fonts.setFontMode(1);                  // use u8g2 transparent mode (this is default)
+    context.fonts.setFontDirection(0);             // left to right (this is default)
+    context.fonts.setForegroundColor(GxEPD_BLACK); // apply Adafruit GFX color
+    context.fonts.setBackgroundColor(GxEPD_WHITE); // apply Adafruit GFX color
+    context.fonts.setFont(u8g2_font_helvB10_tf);   // select u8g2 font from here: https://github.com/olikraus/u8g2/wiki/fntlistall
+}
 
-void InitDisplay()
+void InitDisplay(const displayOptions &options)
 {
+    if (display == NULL)
+    {
+        display = new (displayStorage) Panel::displayType(EpdPanel(/*CS=*/EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RST, /*BUSY=*/EPD_BUSY));
+        panelContext = new (panelContextStorage) renderContext();
+    }
 
-    display.init(115200, true, 2, false);
+    display->init(115200, !options.partialRefresh, 2, false); // a partial first refresh needs initial=false
     SPI.end();
     SPI.begin(EPD_SCK, EPD_MISO, EPD_MOSI, EPD_CS);
-    u8g2Fonts.begin(display);                  // connect u8g2 procedures to Adafruit GFX
-    u8g2Fonts.setFontMode(1);                  // use u8g2 transparent mode (this is default)
-    u8g2Fonts.setFontDirection(0);             // left to right (this is default)
-    u8g2Fonts.setForegroundColor(GxEPD_BLACK); // apply Adafruit GFX color
-    u8g2Fonts.setBackgroundColor(GxEPD_WHITE); // apply Adafruit GFX color
-    u8g2Fonts.setFont(u8g2_font_helvB10_tf);   // select u8g2 font from here: https://github.com/olikraus/u8g2/wiki/fntlistall
-    display.fillScreen(GxEPD_WHITE);
-    display.setFullWindow();
+    BeginRenderContext(*panelContext, *display);
 }
 
-String WeekdayToString(int day)
+const char *WeekdayToString(int day)
 {
     switch (day)
     {
@@ -76,21 +97,58 @@ String WeekdayToString(int day)
 }
 
 // #########################################################################################
-void drawString(int x, int y, String text, alignment align)
+void drawString(renderContext &context, int x, int y, const char *text, alignment align)
 {
     int16_t x1, y1; // the bounds of x,y and w and h of the variable 'text' in pixels.
     uint16_t w, h;
-    display.setTextWrap(false);
-    display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
+    context.target->setTextWrap(false);
+    context.target->getTextBounds(text, x, y, &x1, &y1, &w, &h);
     if (align == RIGHT)
         x = x - w;
     if (align == CENTER)
         x = x - w / 2;
-    u8g2Fonts.setCursor(x, y + h);
-    u8g2Fonts.print(text);
+    context.fonts.setCursor(x, y + h);
+    context.fonts.print(text);
+}
+// #########################################################################################
+// True for the 3 hourly record that starts at hour or in the two hours after it. The services' periods
+// start on UTC hours, so in summer time their local hours run 1, 4, 7 ... instead of 0, 3, 6 ...
+static bool PeriodFrom(const tm &time, int hour)
+{
+    return time.tm_hour >= hour && time.tm_hour < hour + 3;
+}
+
+// Shades the night along a graph's x axis, from each forecast day's sunrise and sunset
+void DrawNightBand(renderContext &context, int x_pos, int y, int gwidth, int numReadings, weatherRecord *weatherRecords, const astronomyDay &astronomy)
+{
+    const int bandHeight = 4;
+    const tm &first = weatherRecords[0].time;
+    long firstDay = DaysFromCivil(first.tm_year + 1900, first.tm_mon + 1, first.tm_mday);
+
+    // the graph spans these minutes, counted from midnight at the start of the first record's day
+    int graphStart = first.tm_hour * 60;
+    int graphEnd = graphStart + (numReadings - 1) * 180; // 3 hourly readings
+
+    for (int d = 0; d < AstronomyHorizonDays; d++)
+    {
+        int midnight = (astronomy.day + d - firstDay) * 1440;
+        int nights[2][2] = {{midnight, midnight + astronomy.horizonSunrise[d]},
+                            {midnight + astronomy.horizonSunset[d], midnight + 1440}};
+        for (int n = 0; n < 2; n++)
+        {
+            int from = max(nights[n][0], graphStart);
+            int to = min(nights[n][1], graphEnd);
+            if (from >= to)
+                continue;
+            int x1 = x_pos + (long)(from - graphStart) * gwidth / (graphEnd - graphStart);
+            int x2 = x_pos + (long)(to - graphStart) * gwidth / (graphEnd - graphStart);
+            context.target->fillRect(x1, y, x2 - x1 + 1, bandHeight, GxEPD_BLACK);
+        }
+    }
 }
+
 // #########################################################################################
-void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, String title, float DataArray[], int numReadings, boolean auto_scale, boolean barchart_mode, weatherRecord *weatherRecords)
+void DrawGraph(renderContext &context, int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, const char *title, float DataArray[], int numReadings, boolean auto_scale, boolean barchart_mode, weatherRecord *weatherRecords, const astronomyDay &astronomy)
 {
 
 #define auto_scale_margin 0 // Sets the autoscale increment, so axis steps up in units of e.g. 3
@@ -151,11 +209,12 @@ void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float
     }
 
     // Draw the graph
-    u8g2Fonts.setFont(u8g2_font_helvB18_tf);
+    bool narrow = gwidth < 300; // smaller panels' graphs take smaller labels
+    context.fonts.setFont(narrow ? u8g2_font_helvB12_tf : u8g2_font_helvB18_tf);
     last_x = x_pos + 1;
     last_y = y_pos + (Y1Max - constrain(DataArray[1], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight;
-    display.drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, GxEPD_BLACK);
-    drawString(x_pos + gwidth / 2 - 30, y_pos - 16, title, CENTER);
+    context.target->drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, GxEPD_BLACK);
+    drawString(context, x_pos + gwidth / 2 - 30, y_pos - 16, title, CENTER);
     // Draw the data
     for (int gx = 1; gx < numReadings; gx++)
     {
@@ -163,96 +222,85 @@ void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float
         y2 = y_pos + (Y1Max - constrain(DataArray[gx], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight + 1;
         if (barchart_mode)
         {
-            display.fillRect(x2, y2, (gwidth / numReadings) - 1, y_pos + gheight - y2 + 2, GxEPD_BLACK);
+            context.target->fillRect(x2, y2, (gwidth / numReadings) - 1, y_pos + gheight - y2 + 2, GxEPD_BLACK);
         }
         else
         {
 
-            // display.drawLine(last_x -2, last_y-2, x2 -2, y2-2, GxEPD_BLACK);
-            // display.drawLine(last_x - 1, last_y-1, x2 - 1, y2-1, GxEPD_BLACK);
-            // display.drawLine(last_x + 1, last_y+1, x2 + 1, y2+1, GxEPD_BLACK);
-            // display.drawLine(last_x + 2, last_y+2, x2 + 2, y2+2, GxEPD_BLACK);
-            display.fillTriangle(last_x, last_y + 2, last_x, last_y - 2, x2, y2 + 2, GxEPD_BLACK);
-            display.fillTriangle(last_x, last_y - 2, x2, y2 + 2, x2, y2 - 1, GxEPD_BLACK);
-            // display.drawLine(last_x, last_y, x2, y2, GxEPD_BLACK);
+            // context.target->drawLine(last_x -2, last_y-2, x2 -2, y2-2, GxEPD_BLACK);
+            // context.target->drawLine(last_x - 1, last_y-1, x2 - 1, y2-1, GxEPD_BLACK);
+            // context.target->drawLine(last_x + 1, last_y+1, x2 + 1, y2+1, GxEPD_BLACK);
+            // context.target->drawLine(last_x + 2, last_y+2, x2 + 2, y2+2, GxEPD_BLACK);
+            context.target->fillTriangle(last_x, last_y + 2, last_x, last_y - 2, x2, y2 + 2, GxEPD_BLACK);
+            context.target->fillTriangle(last_x, last_y - 2, x2, y2 + 2, x2, y2 - 1, GxEPD_BLACK);
+            // context.target->drawLine(last_x, last_y, x2, y2, GxEPD_BLACK);
         }
         last_x = x2;
         last_y = y2;
     }
 
     // Draw the Y-axis scale
-    u8g2Fonts.setFont(u8g2_font_helvB12_tf);
+    context.fonts.setFont(narrow ? u8g2_font_helvB10_tf : u8g2_font_helvB12_tf);
     for (int spacing = 0; spacing <= y_minor_axis; spacing++)
     {
         for (int j = 0; j < number_of_dashes; j++)
         { // Draw dashed graph grid lines
             if (spacing < y_minor_axis)
-                display.drawFastHLine((x_pos + 3 + j * gwidth / number_of_dashes), y_pos + (gheight * spacing / y_minor_axis), gwidth / (2 * number_of_dashes), GxEPD_BLACK);
-        }
-        if ((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing) < 5)
-        {
-            drawString(x_pos - 10, y_pos + gheight * spacing / y_minor_axis, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 0), RIGHT);
-        }
-        else
-        {
-            if (Y1Min < 1 && Y1Max < 10)
-                drawString(x_pos - 10, y_pos + gheight * spacing / y_minor_axis, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 0), RIGHT);
-            else
-                drawString(x_pos - 10, y_pos + gheight * spacing / y_minor_axis, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 0), RIGHT);
+                context.target->drawFastHLine((x_pos + 3 + j * gwidth / number_of_dashes), y_pos + (gheight * spacing / y_minor_axis), gwidth / (2 * number_of_dashes), GxEPD_BLACK);
         }
+        char label[8];
+        snprintf(label, sizeof(label), "%.0f", Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01);
+        drawString(context, x_pos - 10, y_pos + gheight * spacing / y_minor_axis, label, RIGHT);
     }
 
     // x axis
 
+    if (numReadings > 1)
+        DrawNightBand(context, x_pos, y_pos + gheight + 2, gwidth, numReadings, weatherRecords, astronomy);
+
     // ticks
     for (int xTick = 0; xTick < numReadings; xTick++)
     {
         // draw tick every 3 hours, devider at midnight
         int xTickPos = x_pos + xTick * gwidth / (numReadings - 1);
-        Serial.println(weatherRecords[xTick].time.tm_hour);
         // devide days at midnight
-        if (weatherRecords[xTick].time.tm_hour == 0)
+        if (PeriodFrom(weatherRecords[xTick].time, 0))
         {
-            display.drawLine(xTickPos - 1, y_pos, xTickPos - 1, y_pos + gheight + 20, GxEPD_BLACK);
-            display.drawLine(xTickPos, y_pos, xTickPos, y_pos + gheight + 20, GxEPD_BLACK);
+            context.target->drawLine(xTickPos - 1, y_pos, xTickPos - 1, y_pos + gheight + 20, GxEPD_BLACK);
+            context.target->drawLine(xTickPos, y_pos, xTickPos, y_pos + gheight + 20, GxEPD_BLACK);
         }
         else
         {
-            display.drawLine(xTickPos, y_pos + gheight + 1, xTickPos, y_pos + gheight + 6, GxEPD_BLACK);
+            context.target->drawLine(xTickPos, y_pos + gheight + 1, xTickPos, y_pos + gheight + 6, GxEPD_BLACK);
         }
 
         // show day of week at midday
-        if (weatherRecords[xTick].time.tm_hour == 12)
+        if (PeriodFrom(weatherRecords[xTick].time, 12))
         {
-            drawString(x_pos + xTick * gwidth / (numReadings - 1) - 10, y_pos + gheight + 16, WeekdayToString(weatherRecords[xTick].time.tm_wday), CENTER);
+            drawString(context, x_pos + xTick * gwidth / (numReadings - 1) - 10, y_pos + gheight + 16, WeekdayToString(weatherRecords[xTick].time.tm_wday), CENTER);
         }
     }
 }
 
 // #########################################################################################
-void DisplayGraphs(weatherRecord *weatherRecords, int numRecords)
+void DisplayTemperatureGraph(renderContext &context, const widget &w, weatherRecord *weatherRecords, int numRecords, const astronomyDay &astronomy)
 {
-
-    // graphing temperature and rain
     float temps[numRecords];
-    float rains[numRecords];
-
-    for (size_t i = 0; i < numRecords; i++)
+    for (int i = 0; i < numRecords; i++)
     {
         temps[i] = weatherRecords[i].temperature;
-        rains[i] = weatherRecords[i].percentRain;
     }
+    DrawGraph(context, w.x, w.y, w.width, w.height, 10, 30, "Temperature (°C)", temps, numRecords, true, false, weatherRecords, astronomy);
+}
 
-    int gwidth = 300;
-    int gheight = 200;
-
-    int gx = (SCREEN_WIDTH - gwidth * 2) / 3 + 5;
-    int gy = 245;
-    int gap = gwidth + gx;
-
-    DrawGraph(30, gy, 350, gheight, 10, 30, "Temperature (°C)", temps, numRecords, true, false, weatherRecords);
-
-    DrawGraph(420, gy, 360, gheight, 0, 100, "Rain (%)", rains, numRecords, false, false, weatherRecords);
+void DisplayRainGraph(renderContext &context, const widget &w, weatherRecord *weatherRecords, int numRecords, const astronomyDay &astronomy)
+{
+    float rains[numRecords];
+    for (int i = 0; i < numRecords; i++)
+    {
+        rains[i] = weatherRecords[i].percentRain;
+    }
+    DrawGraph(context, w.x, w.y, w.width, w.height, 0, 100, "Rain (%)", rains, numRecords, false, false, weatherRecords, astronomy);
 }
 
 const unsigned char *IconToBitmap(int weatherCode)
@@ -360,173 +408,579 @@ const unsigned char *IconToBitmap(int weatherCode)
     return Thunder;
 }
 
-void DisplayConditionsSection(int x, int y, int weatherCode, float temperature, String title)
+void DisplayConditionsSection(renderContext &context, int x, int y, int weatherCode, float temperature, const char *title)
 {
 
-    display.drawBitmap(x - 80, y - 80, IconToBitmap(weatherCode), 160, 128, GxEPD_BLACK);
+    context.target->drawBitmap(x - 80, y - 80, IconToBitmap(weatherCode), 160, 128, GxEPD_BLACK);
 
-    display.drawRect(x - 86, y - 131, 173, 228, GxEPD_BLACK);
-    u8g2Fonts.setFont(u8g2_font_helvB18_tf);
-    drawString(x - 30, y - 90, title, CENTER);
+    context.target->drawRect(x - 86, y - 131, 173, 228, GxEPD_BLACK);
+    context.fonts.setFont(u8g2_font_helvB18_tf);
+    drawString(context, x - 30, y - 90, title, CENTER);
 
-    u8g2Fonts.setFont(u8g2_font_helvB24_tf);
-    drawString(x - 25, y + 70, String(temperature, 1) + "°C", CENTER); // Show current Temperature
+    context.fonts.setFont(u8g2_font_helvB24_tf);
+    char temperatureText[12];
+    snprintf(temperatureText, sizeof(temperatureText), "%.1f°C", temperature);
+    drawString(context, x - 25, y + 70, temperatureText, CENTER); // Show current Temperature
 }
 
-void DisplayForecastIcons(weatherRecord *weatherRecords, int numRecords, tm *timeNow)
+// Draws a width x height bitmap at half size, a pixel black where any of the four it stands for is, so thin lines survive
+void DrawHalfSizeBitmap(renderContext &context, int x, int y, const unsigned char *bitmap, int width, int height)
 {
-    // big
+    const int byteWidth = (width + 7) / 8;
+    for (int row = 0; row < height / 2; row++)
+    {
+        int runStart = -1;
+        for (int col = 0; col <= width / 2; col++)
+        {
+            bool black = false;
+            if (col < width / 2)
+            {
+                int source = (row * 2) * byteWidth + col / 4; // the byte holding source pixels col*2 and col*2+1
+                uint8_t mask = 0xC0 >> ((col & 3) * 2);
+                black = (pgm_read_byte(&bitmap[source]) | pgm_read_byte(&bitmap[source + byteWidth])) & mask;
+            }
+            if (black && runStart < 0)
+            {
+                runStart = col;
+            }
+            else if (!black && runStart >= 0)
+            {
+                context.target->drawFastHLine(x + runStart, y + row, col - runStart, GxEPD_BLACK);
+                runStart = -1;
+            }
+        }
+    }
+}
+
+// The conditions box for smaller panels: the icon at half size in a box width wide, hanging from y
+void DisplayCompactConditionsSection(renderContext &context, int x, int y, int width, int weatherCode, float temperature, const char *title)
+{
+    context.target->drawRect(x - width / 2, y, width, 118, GxEPD_BLACK);
+    context.fonts.setFont(u8g2_font_helvB10_tf);
+    drawString(context, x, y + 4, title, CENTER);
 
-    int xInc = 172;
+    DrawHalfSizeBitmap(context, x - 40, y + 22, IconToBitmap(weatherCode), 160, 128);
 
-    // if the morning, show midday and evening then tomorrow
+    context.fonts.setFont(u8g2_font_helvB14_tf);
+    char temperatureText[12];
+    snprintf(temperatureText, sizeof(temperatureText), "%.1f°C", temperature);
+    drawString(context, x, y + 92, temperatureText, CENTER);
+}
 
-    // if afternoon, show tomorrow morning and afternoon
+// The moon phases are pre-rendered by scripts/gen_moon_sprites.py, 32 sprites in 23 KB of flash, and drawn a run
+// of pixels at a time. Whether that is faster than the circles and lines on the ESP32 is unmeasured; on the host
+// src/moonBench.cpp finds the two about the same
+void DrawMoon(renderContext &context, int x, int y, int angle)
+{
+    int index = ((angle * MoonSpritePhases + 180) / 360) % MoonSpritePhases; // nearest sprite
+    const unsigned char *sprite = MoonSprites[index];
+    const int byteWidth = (MoonSpriteSize + 7) / 8;
 
-    // morning
-    if (timeNow->tm_hour < 12)
+    // one horizontal line per run of black pixels rather than a pixel at a time
+    for (int row = 0; row < MoonSpriteSize; row++)
     {
-        int xCurrent = 367 - 109;
-
-        // find midday, then show 6pm then 9am tomorrow
-        for (int fIndex = 0; fIndex < numRecords; fIndex++)
+        int runStart = -1;
+        for (int col = 0; col <= MoonSpriteSize; col++)
         {
-
-            if (weatherRecords[fIndex].time.tm_hour == 12)
+            bool black = col < MoonSpriteSize && (pgm_read_byte(&sprite[row * byteWidth + col / 8]) & (0x80 >> (col & 7)));
+            if (black && runStart < 0)
+            {
+                runStart = col;
+            }
+            else if (!black && runStart >= 0)
             {
-                // midday
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex].weatherCode, weatherRecords[fIndex].temperature, "12pm " + WeekdayToString(weatherRecords[fIndex].time.tm_wday));
-                xCurrent += xInc;
+                context.target->drawFastHLine(x + MoonSpriteOffsetX + runStart, y + MoonSpriteOffsetY + row, col - runStart, GxEPD_BLACK);
+                runStart = -1;
+            }
+        }
+    }
+}
 
-                // go forward to 6pm
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex + 2].weatherCode, weatherRecords[fIndex + 2].temperature, "6pm " + WeekdayToString(weatherRecords[fIndex + 2].time.tm_wday));
-                xCurrent += xInc + 109;
+// titles like "12pm Mon", formatted on the stack
+void FormatForecastTitle(char *title, size_t size, const tm &time)
+{
+    int hour12 = time.tm_hour % 12 == 0 ? 12 : time.tm_hour % 12;
+    snprintf(title, size, "%d%s %s", hour12, time.tm_hour < 12 ? "am" : "pm", WeekdayToString(time.tm_wday));
+}
+
+typedef struct
+{
+    const siteForecast *sites; // more than one and each gets a band, instead of the layout showing the first
+    int numSites;
+    weatherRecord *weatherRecords; // the first site's, for the full layout
+    int numRecords;
+    tm *timeNow;
+    const displayOptions *options;
+    astronomyDay astronomy; // a copy, so each scene being drawn has its own
+    int forecastIndex[NumForecastSlots]; // record shown in each forecast slot, -1 for none
+} weatherScene;
+
+// if the morning, show midday and 6pm then 9am tomorrow
+// if the afternoon, show tomorrow 9am, midday and 6pm
+void FindForecastSlots(weatherScene &scene)
+{
+    const int morningOffsets[NumForecastSlots] = {0, 2, 5};   // from midday today
+    const int afternoonOffsets[NumForecastSlots] = {0, 1, 3}; // from 9am tomorrow
+    bool morning = scene.timeNow->tm_hour < 12;
+    const int *offsets = morning ? morningOffsets : afternoonOffsets;
+
+    for (int slot = 0; slot < NumForecastSlots; slot++)
+    {
+        scene.forecastIndex[slot] = -1;
+    }
 
-                // go forward to 9am
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex + 5].weatherCode, weatherRecords[fIndex + 5].temperature, "9am " + WeekdayToString(weatherRecords[fIndex + 5].time.tm_wday));
-                break;
+    for (int fIndex = 0; fIndex < scene.numRecords; fIndex++)
+    {
+        const tm &time = scene.weatherRecords[fIndex].time;
+        bool found = morning ? PeriodFrom(time, 12)
+                             : PeriodFrom(time, 9) && time.tm_wday == ((scene.timeNow->tm_wday + 1) % 7);
+        if (found)
+        {
+            for (int slot = 0; slot < NumForecastSlots; slot++)
+            {
+                if (fIndex + offsets[slot] < scene.numRecords)
+                    scene.forecastIndex[slot] = fIndex + offsets[slot];
             }
+            break;
         }
     }
-    // afternoon
-    else
+}
+
+void DisplaySunTimes(renderContext &context, int x, int y, const astronomyDay &astronomy)
+{
+    context.fonts.setFont(u8g2_font_helvB24_tf);
+    char day_output[6];
+    sprintf(day_output, "%02u:%02u", (astronomy.sunrise / 60), (astronomy.sunrise % 60));
+    drawString(context, x, y, day_output, LEFT);
+    sprintf(day_output, "%02u:%02u", (astronomy.sunset / 60), (astronomy.sunset % 60));
+    drawString(context, x, y + 30, day_output, LEFT);
+}
+
+void DisplayMoonPhase(renderContext &context, int x, int y, const astronomyDay &astronomy)
+{
+    Serial.print("Moon phase angle: ");
+    Serial.print(astronomy.moonAngle); // angle is a integer between 0-360
+    Serial.println(" degrees.");
+    Serial.print("Moon surface lit: ");
+    Serial.println(astronomy.moonPercentLit * 100); // percentLit is a real between 0-1
+
+    DrawMoon(context, x, y, astronomy.moonAngle);
+}
+
+// One site's band when several share the screen: its name and conditions now, then the next few periods
+void DisplaySiteBand(renderContext &context, const widget &w, const siteForecast &site)
+{
+    if (w.top > 0)
+        context.target->drawFastHLine(0, w.top, w.width, GxEPD_BLACK);
+    context.fonts.setFont(u8g2_font_helvB18_tf);
+    drawString(context, 10, w.top + 8, site.name, LEFT);
+    if (site.numRecords == 0)
     {
-        int xCurrent = 367;
-        // find 9am tomorrow, then 12 and 6pm
-        for (int fIndex = 0; fIndex < numRecords; fIndex++)
-        {
+        context.fonts.setFont(u8g2_font_helvB12_tf);
+        drawString(context, 10, w.top + 44, "No forecast", LEFT);
+        return;
+    }
 
-            if (weatherRecords[fIndex].time.tm_hour == 9 && weatherRecords[fIndex].time.tm_wday == ((timeNow->tm_wday + 1) % 7))
-            {
+    const weatherRecord &now = site.records[0];
+    char text[16];
+    context.fonts.setFont(u8g2_font_helvB24_tf);
+    snprintf(text, sizeof(text), "%.1f°C", now.temperature);
+    drawString(context, 10, w.top + 44, text, LEFT);
+    context.fonts.setFont(u8g2_font_helvB12_tf);
+    snprintf(text, sizeof(text), "%.0f%% rain", now.percentRain);
+    drawString(context, 10, w.top + 84, text, LEFT);
+    if (SiteBandIcon && w.height >= 128) // the icon only where the band is tall enough for it
+        context.target->drawBitmap(170, w.top + (w.height - 128) / 2, IconToBitmap(now.weatherCode), 160, 128, GxEPD_BLACK);
+
+    int columnWidth = (w.width - SiteBandPeriodsX) / SiteBandPeriods;
+    for (int i = 1; i <= SiteBandPeriods && i < site.numRecords; i++)
+    {
+        const weatherRecord &record = site.records[i];
+        int x = SiteBandPeriodsX + (i - 1) * columnWidth + columnWidth / 2;
+        context.fonts.setFont(u8g2_font_helvB10_tf);
+        FormatForecastTitle(text, sizeof(text), record.time);
+        drawString(context, x, w.top + 12, text, CENTER);
+        context.fonts.setFont(u8g2_font_helvB14_tf);
+        snprintf(text, sizeof(text), "%.0f°", record.temperature);
+        drawString(context, x, w.top + 38, text, CENTER);
+        context.fonts.setFont(u8g2_font_helvB10_tf);
+        snprintf(text, sizeof(text), "%.0f%%", record.percentRain);
+        drawString(context, x, w.top + 68, text, CENTER);
+    }
+}
 
-                // 9am
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex].weatherCode, weatherRecords[fIndex].temperature, "9am " + WeekdayToString(weatherRecords[fIndex].time.tm_wday));
-                xCurrent += xInc;
-                // go forward to midday
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex + 1].weatherCode, weatherRecords[fIndex + 1].temperature, "12pm " + WeekdayToString(weatherRecords[fIndex + 1].time.tm_wday));
-                xCurrent += xInc;
+void DisplayWidget(renderContext &context, const widget &w, const weatherScene &scene)
+{
+    weatherRecord *weatherRecords = scene.weatherRecords;
 
-                // go forward to 6pm
-                DisplayConditionsSection(xCurrent, 114, weatherRecords[fIndex + 3].weatherCode, weatherRecords[fIndex + 3].temperature, "6pm " + WeekdayToString(weatherRecords[fIndex + 3].time.tm_wday));
-                break;
-            }
+    switch (w.kind)
+    {
+    case WIDGET_CONDITIONS_NOW:
+    {
+        char title[16];
+        snprintf(title, sizeof(title), "Now (%s)", WeekdayToString(weatherRecords[0].time.tm_wday));
+        if (w.width > 0)
+            DisplayCompactConditionsSection(context, w.x, w.y, w.width, weatherRecords[0].weatherCode, weatherRecords[0].temperature, title);
+        else
+            DisplayConditionsSection(context, w.x, w.y, weatherRecords[0].weatherCode, weatherRecords[0].temperature, title);
+        break;
+    }
+    case WIDGET_FORECAST:
+    {
+        int fIndex = scene.forecastIndex[w.slot];
+        if (fIndex >= 0)
+        {
+            char title[16];
+            FormatForecastTitle(title, sizeof(title), weatherRecords[fIndex].time);
+            if (w.width > 0)
+                DisplayCompactConditionsSection(context, w.x, w.y, w.width, weatherRecords[fIndex].weatherCode, weatherRecords[fIndex].temperature, title);
+            else
+                DisplayConditionsSection(context, w.x, w.y, weatherRecords[fIndex].weatherCode, weatherRecords[fIndex].temperature, title);
         }
+        break;
+    }
+#if LAYOUT_SHOW_SUN
+    case WIDGET_SUN:
+        DisplaySunTimes(context, w.x, w.y, scene.astronomy);
+        break;
+#endif
+#if LAYOUT_SHOW_MOON
+    case WIDGET_MOON:
+        if (scene.options->showMoon)
+            DisplayMoonPhase(context, w.x, w.y, scene.astronomy);
+        break;
+#endif
+#if LAYOUT_SHOW_GRAPHS
+    case WIDGET_TEMPERATURE_GRAPH:
+        if (scene.options->showGraphs && scene.numRecords > 1) // the x axis needs two readings
+            DisplayTemperatureGraph(context, w, weatherRecords, scene.numRecords, scene.astronomy);
+        break;
+    case WIDGET_RAIN_GRAPH:
+        if (scene.options->showGraphs && scene.numRecords > 1)
+            DisplayRainGraph(context, w, weatherRecords, scene.numRecords, scene.astronomy);
+        break;
+#endif
+    case WIDGET_STATUS_LINE:
+        if (scene.options->statusLine != NULL)
+        {
+            context.fonts.setFont(u8g2_font_helvB08_tf);
+            drawString(context, w.x, w.y, scene.options->statusLine, RIGHT);
+        }
+        break;
+    case WIDGET_SITE:
+        DisplaySiteBand(context, w, scene.sites[w.slot]);
+        break;
+    default:
+        break;
     }
 }
-void DrawMoon(int x, int y, double phase)
-{
-    const int diameter = 70;
 
-    // Draw dark part of moon
-    display.fillCircle(x + diameter - 1, y + diameter, diameter / 2 + 1, GxEPD_BLACK);
-    const int number_of_lines = 90;
-    for (double Ypos = 0; Ypos <= number_of_lines / 2; Ypos++)
+// Draws the widgets of the scene's layout that reach into rows top to bottom
+void DrawWidgets(renderContext &context, const weatherScene &scene, int16_t top, int16_t bottom)
+{
+    if (scene.numSites > 1)
     {
-        double Xpos = sqrt(number_of_lines / 2 * number_of_lines / 2 - Ypos * Ypos);
-        // Determine the edges of the lighted part of the moon
-        double Rpos = 2 * Xpos;
-        double Xpos1, Xpos2;
-        if (phase < 0.5)
+        int16_t bandHeight = (SiteBandsBottom + 1) / scene.numSites;
+        for (int i = 0; i < scene.numSites; i++)
         {
-            Xpos1 = -Xpos;
-            Xpos2 = Rpos - 2 * phase * Rpos - Xpos;
+            int16_t bandTop = i * bandHeight;
+            widget band = {WIDGET_SITE, 0, bandTop, bandTop, (int16_t)(bandTop + bandHeight - 1), Panel::width, bandHeight, (uint8_t)i};
+            if (band.bottom >= top && band.top <= bottom)
+                DisplayWidget(context, band, scene);
         }
-        else
+        if (SiteStatusLine.bottom >= top && SiteStatusLine.top <= bottom)
+            DisplayWidget(context, SiteStatusLine, scene);
+        return;
+    }
+
+    bool morning = scene.timeNow->tm_hour < 12;
+    const widget *layout = morning ? LayoutMorning : LayoutAfternoon;
+    int numWidgets = morning ? sizeof(LayoutMorning) / sizeof(widget) : sizeof(LayoutAfternoon) / sizeof(widget);
+
+    for (int i = 0; i < numWidgets; i++)
+    {
+        if (layout[i].bottom >= top && layout[i].top <= bottom)
+            DisplayWidget(context, layout[i], scene);
+    }
+}
+
+weatherScene MakeScene(const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options)
+{
+    const siteForecast &first = sites[0];
+    weatherScene scene = {sites, numSites, first.records, first.numRecords, timeNow, &options};
+    GetAstronomy(scene.astronomy, timeNow, first.latitude, first.longitude);
+    FindForecastSlots(scene);
+    return scene;
+}
+
+void DrawWeather(renderContext &context, const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options)
+{
+    weatherScene scene = MakeScene(sites, numSites, timeNow, options);
+    DrawWidgets(context, scene, 0, Panel::height - 1);
+}
+
+// 64 bit FNV-1a, continued from hash over more bytes
+uint64_t HashBytes(uint64_t hash, const uint8_t *bytes, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+const uint64_t HashSeed = 14695981039346656037ULL;
+
+template <typename T>
+uint64_t HashValue(uint64_t hash, const T &value)
+{
+    return HashBytes(hash, (const uint8_t *)&value, sizeof(value));
+}
+
+// Everything the widgets draw from, field by field so struct padding never counts. Two scenes with the
+// same fingerprint draw the same frame, but for the status line: its figures change every wake, so
+// counting it would refresh the panel every wake. It is redrawn when something else needs a refresh
+uint64_t SceneFingerprint(const weatherScene &scene)
+{
+    uint64_t hash = HashValue(HashSeed, LayoutVersion);
+    hash = HashValue(hash, (uint8_t)(scene.timeNow->tm_hour < 12)); // picks the layout
+    hash = HashValue(hash, scene.forecastIndex);
+    hash = HashValue(hash, scene.numSites);
+    for (int site = 0; site < scene.numSites; site++)
+    {
+        const siteForecast &forecast = scene.sites[site];
+        hash = HashBytes(hash, (const uint8_t *)forecast.name, strlen(forecast.name) + 1);
+        hash = HashValue(hash, forecast.numRecords);
+        for (int i = 0; i < forecast.numRecords; i++)
         {
-            Xpos1 = Xpos;
-            Xpos2 = Xpos - 2 * phase * Rpos + Rpos;
+            const weatherRecord &record = forecast.records[i];
+            const int when[] = {record.time.tm_year, record.time.tm_mon, record.time.tm_mday, record.time.tm_hour, record.time.tm_wday};
+            hash = HashValue(hash, when);
+            hash = HashValue(hash, record.weatherCode);
+            hash = HashValue(hash, record.temperature);
+            hash = HashValue(hash, record.percentRain);
         }
-        // Draw light part of moon
-        double pW1x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
-        double pW1y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
-        double pW2x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
-        double pW2y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
-        double pW3x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
-        double pW3y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
-        double pW4x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
-        double pW4y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
-        display.drawLine(pW1x, pW1y, pW2x, pW2y, GxEPD_WHITE);
-        display.drawLine(pW3x, pW3y, pW4x, pW4y, GxEPD_WHITE);
     }
-    display.drawCircle(x + diameter - 1, y + diameter, diameter / 2, GxEPD_BLACK);
+    hash = HashValue(hash, scene.astronomy.day); // with the location, fixes the sun
+    hash = HashValue(hash, scene.astronomy.latitude);
+    hash = HashValue(hash, scene.astronomy.longitude);
+    hash = HashValue(hash, scene.astronomy.moonAngle);
+    hash = HashValue(hash, scene.options->showGraphs);
+    hash = HashValue(hash, scene.options->showMoon);
+    return hash;
 }
 
-void DisplayAstronomySection(tm *timeNow, int xOffset, double latitude, double longitude)
+// True when the panel already shows what DisplayWeather would draw from these, so there is nothing to do
+bool DisplayUpToDate(const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options)
 {
+    weatherScene scene = MakeScene(sites, numSites, timeNow, options);
+    return lastSceneFingerprint != 0 && SceneFingerprint(scene) == lastSceneFingerprint;
+}
+
+// A band of rows of the screen, drawn in screen coordinates: pixels outside top..top+height-1 are dropped.
+// Lines go through drawPixel so every pixel is moved exactly once
+class StripCanvas : public GFXcanvas1
+{
+public:
+    StripCanvas(uint16_t w, uint16_t h) : GFXcanvas1(w, h), top(0) {}
 
-    SunSet sun;
-    sun.setPosition(latitude, longitude, 0);
-    sun.setCurrentDate((timeNow->tm_year + 1900), (timeNow->tm_mon + 1), timeNow->tm_mday);
-    int sunrise = static_cast<int>(sun.calcSunrise());
-    int sunset = static_cast<int>(sun.calcSunset());
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override { GFXcanvas1::drawPixel(x, y - top, color); }
 
-    if (timeNow->tm_isdst > 0)
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
     {
-        sunrise += 60;
-        sunset += 60;
+        for (int16_t i = 0; i < h; i++)
+            drawPixel(x, y + i, color);
     }
 
-    u8g2Fonts.setFont(u8g2_font_helvB24_tf);
-    char day_output[5];
-    sprintf(day_output, "%02u:%02u", (sunrise / 60), (sunrise % 60));
-    drawString(187 + xOffset, 50, day_output, LEFT);
-    sprintf(day_output, "%02u:%02u", (sunset / 60), (sunset % 60));
-    drawString(187 + xOffset, 80, day_output, LEFT);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        for (int16_t i = 0; i < w; i++)
+            drawPixel(x + i, y, color);
+    }
 
-    time_t now = time(NULL);
-    struct tm *now_utc = gmtime(&now);
-    const int day_utc = now_utc->tm_mday;
-    const int month_utc = now_utc->tm_mon + 1;
-    const int year_utc = now_utc->tm_year + 1900;
+    int16_t top;
+};
 
-    moonData_t moon;
+// Hashes the frame the scene draws a strip at a time, without a frame buffer or the panel; 0 if out of memory.
+// The status line is left out, as from SceneFingerprint
+uint64_t HashScene(const weatherScene &drawn)
+{
+    displayOptions options = *drawn.options;
+    options.statusLine = NULL;
+    weatherScene scene = drawn;
+    scene.options = &options;
+
+    const int16_t stripRows = 32;
+    StripCanvas strip(Panel::width, stripRows);
+    if (strip.getBuffer() == NULL)
+        return 0;
+    renderContext context;
+    BeginRenderContext(context, strip);
+
+    uint64_t hash = HashSeed;
+    for (strip.top = 0; strip.top < Panel::height; strip.top += stripRows)
+    {
+        int16_t rows = min(stripRows, (int16_t)(Panel::height - strip.top));
+        strip.fillScreen(GxEPD_WHITE);
+        DrawWidgets(context, scene, strip.top, strip.top + rows - 1);
+        hash = HashBytes(hash, strip.getBuffer(), rows * Panel::stride);
+    }
+    return hash;
+}
 
-    moonPhase moonPhase;
-    moon = moonPhase.getPhase(); // gets the current moon phase ( 1/1/1970 at 00:00:00 UTC )
+#ifdef FRAME_DIFF
+static const char StoredFramePath[] = "/littlefs/frame.bin";
 
-    Serial.print("Moon phase angle: ");
-    Serial.print(moon.angle); // angle is a integer between 0-360
-    Serial.println(" degrees.");
-    Serial.print("Moon surface lit: ");
-    Serial.println(moon.percentLit * 100); // percentLit is a real between 0-1
+// Draws the whole screen off-screen and, for a partial refresh, updates only the rectangles that differ
+// from the frame shown last wake. False if there is no memory or filesystem for it
+bool DisplayChangedRects(const weatherScene &scene, const displayOptions &options)
+{
+    static frameDiff diff;
+    if (!LittleFS.begin(true))
+    {
+        Serial.println("LittleFS mount failed, no frame diff");
+        return false;
+    }
+    GFXcanvas1 canvas(Panel::width, Panel::height);
+    if (canvas.getBuffer() == NULL)
+    {
+        Serial.println("No memory for the frame, no frame diff");
+        return false;
+    }
+
+    BeginPhase(PHASE_RENDER);
+    unsigned long start = millis();
+    // hashed without the status line, so it alone never costs a refresh; when one happens its rows
+    // are diffed with the rest of the frame
+    uint64_t frameHash = HashScene(scene);
+    if (frameHash != 0 && frameHash == lastFrameHash)
+    {
+        Serial.printf("Frame unchanged, no refresh (hashed in %lu ms)\n", millis() - start);
+        return true;
+    }
+
+    canvas.fillScreen(GxEPD_WHITE);
+    renderContext context;
+    BeginRenderContext(context, canvas);
+    DrawWidgets(context, scene, 0, Panel::height - 1);
+    const uint8_t *frame = canvas.getBuffer();
+
+    frameRect rects[FRAME_DIFF_MAX_RECTS];
+    int numRects = -1; // full refresh
+    if (options.partialRefresh && DiffStoredFrame(StoredFramePath, frame, diff))
+    {
+        numRects = FinishFrameDiff(diff, rects, FRAME_DIFF_MAX_RECTS);
+        PrintFrameDiffStats(diff.stats);
+    }
 
-    double phase = ((double)moon.angle + 180) / 360;
+    BeginPhase(PHASE_REFRESH);
+    InitDisplay(options); // only now that there is something to send
+    if (numRects < 0)
+    {
+        display->setFullWindow();
+        display->writeImage(frame, 0, 0, Panel::width, Panel::height, false, false, false);
+        display->refresh(false);
+    }
+    for (int i = 0; i < numRects; i++)
+    {
+        const frameRect &r = rects[i];
+        display->writeImagePart(frame, r.x, r.y, Panel::width, Panel::height, r.x, r.y, r.w, r.h, false, false, false);
+        display->refresh(r.x, r.y, r.w, r.h);
+    }
+    if (numRects != 0 && !StoreFrame(StoredFramePath, frame))
+        Serial.println("Could not store the frame");
+    lastFrameHash = frameHash;
 
-    Serial.print("moon phase 0-1 0=full, 0.5=new, 1 = full");
-    Serial.println(phase);
-    DrawMoon(157 + xOffset, 90, phase);
+    Serial.printf("Panel %s, %d rectangles refreshed: total %lu ms\n", EPD_PANEL_NAME, numRects < 0 ? 1 : numRects, millis() - start);
+    return true;
 }
+#endif
 
-void DisplayWeather(weatherRecord *weatherRecords, int numRecords, tm *timeNow, double latitude, double longitude)
+void DisplayWeather(const siteForecast *sites, int numSites, tm *timeNow, const displayOptions &options)
 {
+    weatherScene scene = MakeScene(sites, numSites, timeNow, options);
 
-    DisplayGraphs(weatherRecords, numRecords);
+    uint64_t sceneFingerprint = SceneFingerprint(scene);
 
-    DisplayConditionsSection(86, 114, weatherRecords[0].weatherCode, weatherRecords[0].temperature, "Now (" + WeekdayToString(weatherRecords[0].time.tm_wday) + ")");
+#ifdef FRAME_DIFF
+    if (DisplayChangedRects(scene, options))
+    {
+        lastSceneFingerprint = sceneFingerprint;
+        return;
+    }
+#endif
 
-    DisplayForecastIcons(weatherRecords, numRecords, timeNow);
+    // Drawing the screen twice is far cheaper than a refresh that changes nothing
+    unsigned long hashStart = millis();
+    uint64_t frameHash = HashScene(scene);
+    if (frameHash != 0 && frameHash == lastFrameHash)
+    {
+        Serial.printf("Frame unchanged, no refresh (hashed in %lu ms)\n", millis() - hashStart);
+        lastSceneFingerprint = sceneFingerprint;
+        return;
+    }
+    Serial.printf("Frame changed (hashed in %lu ms)\n", millis() - hashStart);
 
-    DisplayAstronomySection(timeNow, timeNow->tm_hour < 12 ? (173 * 2) : 0, latitude, longitude);
+    // The panel is only woken once there is a new frame for it
+    InitDisplay(options);
 
-    display.display(false); // Full screen update mode
+    // Full window for a full refresh, a screen-sized partial window for the fast update
+    if (options.partialRefresh)
+        display->setPartialWindow(0, 0, Panel::width, Panel::height);
+    else
+        display->setFullWindow();
+
+    // Only EPD_PAGE_HEIGHT rows are buffered at once; each page draws just the widgets that reach into it.
+    // nextPage() sends the page to the panel and refreshes after the last one
+    unsigned long start = millis();
+    unsigned long renderMicros = 0;
+    uint32_t allocationsBefore = HeapAllocationCount();
+    int16_t pageTop = 0;
+    display->firstPage();
+    do
+    {
+        BeginPhase(PHASE_RENDER);
+        unsigned long pageStart = micros();
+        DrawWidgets(*panelContext, scene, pageTop, pageTop + Panel::pageHeight - 1);
+        renderMicros += micros() - pageStart;
+        ReportHeapAllocations("render", allocationsBefore);
+        pageTop += Panel::pageHeight;
+        BeginPhase(PHASE_REFRESH);
+        allocationsBefore = HeapAllocationCount(); // nextPage() itself is not ours to count
+    } while (display->nextPage());
+    lastFrameHash = frameHash;
+    lastSceneFingerprint = sceneFingerprint;
+
+    Serial.printf("Panel %s, %u pages of %u rows: render %lu us, total %lu ms\n", EPD_PANEL_NAME, Panel::pages, Panel::pageHeight, renderMicros, millis() - start);
+}
+
+// Thin client: the render proxy has already drawn the screen, so its 1 bpp rows go straight into the
+// panel's RAM a few at a time, with no frame buffer and no drawing on the device
+bool WriteFrame(Stream &frame, const displayOptions &options)
+{
+    const int16_t rowsPerChunk = 16;
+    uint8_t rows[rowsPerChunk * Panel::stride];
+
+    unsigned long start = millis();
+    for (int16_t y = 0; y < Panel::height; y += rowsPerChunk)
+    {
+        int16_t count = min(rowsPerChunk, (int16_t)(Panel::height - y));
+        size_t bytes = count * Panel::stride;
+        if (frame.readBytes((char *)rows, bytes) != bytes)
+        {
+            Serial.printf("Frame truncated at row %d\n", y);
+            return false;
+        }
+        if (y == 0)
+            InitDisplay(options); // the panel is only woken once the frame has started to arrive
+        display->writeImage(rows, 0, y, Panel::width, count, false, false, false);
+    }
+    Serial.printf("Frame received in %lu ms\n", millis() - start);
+    return true;
+}
+
+void RefreshFrame()
+{
+    display->refresh(false); // the panel's previous image is gone after deep sleep, so no partial update
 }
@@ -0,0 +1,64 @@
+#include <Arduino.h>
+#include <energy.h>
+
+static const char *PhaseNames[NUM_WAKE_PHASES] = {"boot", "wifi", "http", "render", "refresh"};
+
+static unsigned long phaseMillis[NUM_WAKE_PHASES];
+static wakePhase currentPhase = PHASE_BOOT;
+static unsigned long currentPhaseStart = 0; // millis() starts with the app, after the ROM and second stage bootloader
+
+// the refresh happens after the status line is drawn, so the screen shows the previous wake's figures
+RTC_DATA_ATTR static energyEstimate lastEstimate;
+RTC_DATA_ATTR static bool haveLastEstimate = false;
+
+void BeginPhase(wakePhase phase)
+{
+    unsigned long now = millis();
+    phaseMillis[currentPhase] += now - currentPhaseStart;
+    currentPhase = phase;
+    currentPhaseStart = now;
+}
+
+energyEstimate EstimateEnergy(const energyModel &model, long sleepSeconds)
+{
+    BeginPhase(PHASE_BOOT); // closes off whichever phase is still running
+
+    // the bootloader runs before millis() starts counting, so its time comes from the model
+    float milliAmpMillis = model.bootloaderMillis * model.phaseMilliAmps[PHASE_BOOT];
+    unsigned long awakeMillis = model.bootloaderMillis;
+    for (int i = 0; i < NUM_WAKE_PHASES; i++)
+    {
+        milliAmpMillis += phaseMillis[i] * model.phaseMilliAmps[i];
+        awakeMillis += phaseMillis[i];
+    }
+
+    energyEstimate estimate;
+    estimate.wakeMilliAmpHours = milliAmpMillis / 3600000.0;
+    estimate.cycleMilliAmpHours = estimate.wakeMilliAmpHours + sleepSeconds * model.sleepMilliAmps / 3600.0;
+
+    float cyclesPerDay = 86400.0 / (awakeMillis / 1000.0 + sleepSeconds);
+    estimate.projectedDays = model.batteryMilliAmpHours / (estimate.cycleMilliAmpHours * cyclesPerDay);
+
+    lastEstimate = estimate;
+    haveLastEstimate = true;
+    return estimate;
+}
+
+void PrintEnergyReport(const energyEstimate &estimate)
+{
+    Serial.println("Wake phases (ms):");
+    for (int i = 0; i < NUM_WAKE_PHASES; i++)
+    {
+        Serial.printf("  %-8s %lu\n", PhaseNames[i], phaseMillis[i]);
+    }
+    Serial.printf("Energy: %.4f mAh awake, %.4f mAh per cycle, %.0f days projected\n",
+                  estimate.wakeMilliAmpHours, estimate.cycleMilliAmpHours, estimate.projectedDays);
+}
+
+bool LastEnergyEstimate(energyEstimate &estimate)
+{
+    if (!haveLastEstimate)
+        return false;
+    estimate = lastEstimate;
+    return true;
+}
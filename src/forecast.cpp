@@ -0,0 +1,137 @@
+#include <Arduino.h>
+#include <forecast.h>
+#include <astronomy.h>
+
+// DataPoint sends its numbers as JSON strings; this reads either form without making a String
+template <typename TVariant>
+float JsonToFloat(const TVariant &value)
+{
+    if (value.template is<const char *>())
+        return atof(value.template as<const char *>());
+    return value.template as<float>();
+}
+
+// The next byte that is not JSON whitespace, -1 at the end. readBytes waits out the stream's timeout
+// where read() would give up as soon as the socket is momentarily empty
+static int ReadNonSpace(Stream &body)
+{
+    char c;
+    do
+    {
+        if (body.readBytes(&c, 1) != 1)
+            return -1;
+    } while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    return c;
+}
+
+bool FindArray(Stream &body, const char *key)
+{
+    size_t keyLength = strlen(key);
+    size_t matched = 0; // of '"', key, '"'
+    char c;
+    while (body.readBytes(&c, 1) == 1)
+    {
+        char expected = matched == 0 || matched == keyLength + 1 ? '"' : key[matched - 1];
+        if (c != expected)
+        {
+            matched = c == '"' ? 1 : 0;
+            continue;
+        }
+        if (++matched < keyLength + 2)
+            continue;
+        matched = 0;
+        if (ReadNonSpace(body) == ':') // not a string value that happens to match
+            return ReadNonSpace(body) == '[';
+    }
+    return false;
+}
+
+bool NextArrayElement(Stream &body)
+{
+    return ReadNonSpace(body) == ',';
+}
+
+// One DataPoint Rep (a 3 hour period) of the day starting at utcDay, in days since 1970-01-01
+static void DecodeRep(JsonObject repItem, long utcDay, weatherRecord &record)
+{
+    record.temperature = JsonToFloat(repItem["T"]);
+    record.percentRain = JsonToFloat(repItem["Pp"]);
+    record.weatherCode = (int)JsonToFloat(repItem["W"]);
+
+    // minutes after UTC midnight, shown in local time like the OpenWeatherMap records
+    time_t when = utcDay * 86400L + (long)JsonToFloat(repItem["$"]) * 60;
+    localtime_r(&when, &record.time);
+}
+
+// Appends the Reps of one DataPoint Period (a day) to records, returns the new count
+static int DecodeForecastDay(JsonObject day, weatherRecord *records, int recordIndex, int maxRecords)
+{
+    const char *dayValue = day["value"] | "";
+    Serial.print("Day ");
+    Serial.println(dayValue);
+
+    int year = 1970, month = 1, date = 1;
+    sscanf(dayValue, "%d-%d-%d", &year, &month, &date); // a UTC date, "2026-10-23Z"
+    long utcDay = DaysFromCivil(year, month, date);   // once per day rather than per Rep
+
+    // a day with a single period has it as the Rep object itself, not an array of one
+    if (day["Rep"].is<JsonObject>())
+    {
+        if (recordIndex < maxRecords)
+            DecodeRep(day["Rep"].as<JsonObject>(), utcDay, records[recordIndex++]);
+        return recordIndex;
+    }
+    for (JsonObject repItem : day["Rep"].as<JsonArray>())
+    {
+        if (recordIndex == maxRecords)
+        {
+            Serial.printf("More than %d forecast periods, the rest are dropped\n", maxRecords);
+            return recordIndex;
+        }
+        DecodeRep(repItem, utcDay, records[recordIndex++]);
+    }
+    return recordIndex;
+}
+
+int DecodeForecast(JsonObject root, weatherRecord *records, int maxRecords)
+{
+    JsonObject forecastRoot = root["SiteRep"]["DV"]["Location"];
+
+    int recordIndex = 0;
+    for (JsonObject day : forecastRoot["Period"].as<JsonArray>())
+    {
+        recordIndex = DecodeForecastDay(day, records, recordIndex, maxRecords);
+        if (recordIndex == maxRecords)
+            break;
+    }
+    return recordIndex;
+}
+
+static void FormatDataPointUri(char *uri, size_t size, const forecastLocation &location, const char *apikey, int maxRecords)
+{
+    snprintf(uri, size, "/public/data/val/wxfcs/all/json/%s?res=3hourly&key=%s", location.locationId, apikey);
+}
+
+// Skips to SiteRep.DV.Location.Period and deserializes its days one by one
+static int DecodeDataPointBody(Stream &body, JsonDocument &doc, weatherRecord *records, int maxRecords)
+{
+    if (!FindArray(body, "Period"))
+    {
+        Serial.println("No forecast periods in the response");
+        return 0;
+    }
+    int recordIndex = 0;
+    do
+    {
+        DeserializationError error = deserializeJson(doc, body);
+        if (error)
+        {
+            Serial.printf("Forecast day after %d records: %s\n", recordIndex, error.c_str());
+            return 0;
+        }
+        recordIndex = DecodeForecastDay(doc.as<JsonObject>(), records, recordIndex, maxRecords);
+    } while (recordIndex < maxRecords && NextArrayElement(body));
+    return recordIndex;
+}
+
+const forecastSource DataPointSource = {"DataPoint", "datapoint.metoffice.gov.uk", FormatDataPointUri, DecodeDataPointBody};
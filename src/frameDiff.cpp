@@ -0,0 +1,157 @@
+#include <Arduino.h>
+#include <frameDiff.h>
+
+void BeginFrameDiff(frameDiff &diff)
+{
+    memset(diff.changedRows, 0, sizeof(diff.changedRows));
+    memset(&diff.stats, 0, sizeof(diff.stats));
+}
+
+static bool RowChanged(const frameDiff &diff, int16_t y)
+{
+    return diff.changedRows[y / 32] & (1UL << (y % 32));
+}
+
+void DiffFrameRows(frameDiff &diff, int16_t y, int16_t rows, const uint8_t *previous, const uint8_t *current)
+{
+    unsigned long start = micros();
+    for (int16_t row = 0; row < rows; row++, y++)
+    {
+        int first = -1, last = -1;
+        for (int word = 0; word < FrameDiffWordsPerRow; word++)
+        {
+            uint32_t a, b; // memcpy, as the rows need not be 4 byte aligned
+            memcpy(&a, previous + row * Panel::stride + word * 4, 4);
+            memcpy(&b, current + row * Panel::stride + word * 4, 4);
+            uint32_t changed = a ^ b;
+            if (changed == 0)
+                continue;
+            diff.stats.changedPixels += __builtin_popcount(changed);
+            if (first < 0)
+                first = word;
+            last = word;
+        }
+        if (first >= 0)
+        {
+            diff.changedRows[y / 32] |= 1UL << (y % 32);
+            diff.firstWord[y] = first;
+            diff.lastWord[y] = last;
+        }
+    }
+    diff.stats.micros += micros() - start;
+}
+
+static long RefreshCost(const frameRect &rect)
+{
+    return FRAME_DIFF_REFRESH_COST + (long)rect.w * rect.h;
+}
+
+static frameRect BoundingRect(const frameRect &a, const frameRect &b)
+{
+    int16_t left = min(a.x, b.x);
+    int16_t right = max(a.x + a.w, b.x + b.w);
+    frameRect rect = {left, a.y, (int16_t)(right - left), (int16_t)(b.y + b.h - a.y)};
+    return rect;
+}
+
+int FinishFrameDiff(frameDiff &diff, frameRect *rects, int maxRects)
+{
+    unsigned long start = micros();
+
+    // Runs of changed rows become bands spanning the changed columns of all their rows. Only
+    // FRAME_DIFF_MAX_RECTS are kept; past that the band is merged into the one above
+    frameRect bands[FRAME_DIFF_MAX_RECTS];
+    int numBands = 0;
+    for (int16_t y = 0; y < Panel::height; y++)
+    {
+        if (!RowChanged(diff, y))
+            continue;
+        int16_t top = y;
+        int first = diff.firstWord[y], last = diff.lastWord[y];
+        while (y + 1 < Panel::height && RowChanged(diff, y + 1))
+        {
+            y++;
+            first = min(first, (int)diff.firstWord[y]);
+            last = max(last, (int)diff.lastWord[y]);
+        }
+        frameRect band = {(int16_t)(first * 32), top, (int16_t)((last - first + 1) * 32), (int16_t)(y - top + 1)};
+        if (numBands == FRAME_DIFF_MAX_RECTS)
+            bands[numBands - 1] = BoundingRect(bands[numBands - 1], band);
+        else
+            bands[numBands++] = band;
+    }
+
+    // Merge neighbouring bands, biggest saving first, while that costs less than refreshing them apart
+    // or there are more than the caller takes. Bands are disjoint and in order, so a neighbour's
+    // bounding box never takes in a third band
+    maxRects = constrain(maxRects, 1, FRAME_DIFF_MAX_RECTS);
+    while (numBands > 1)
+    {
+        int best = 0;
+        long bestSaving = 0;
+        for (int i = 0; i + 1 < numBands; i++)
+        {
+            long saving = RefreshCost(bands[i]) + RefreshCost(bands[i + 1]) - RefreshCost(BoundingRect(bands[i], bands[i + 1]));
+            if (i == 0 || saving > bestSaving)
+            {
+                best = i;
+                bestSaving = saving;
+            }
+        }
+        if (bestSaving < 0 && numBands <= maxRects)
+            break;
+        bands[best] = BoundingRect(bands[best], bands[best + 1]);
+        numBands--;
+        memmove(&bands[best + 1], &bands[best + 2], (numBands - best - 1) * sizeof(frameRect));
+    }
+
+    diff.stats.rectangles = numBands;
+    diff.stats.refreshedPixels = 0;
+    for (int i = 0; i < numBands; i++)
+    {
+        rects[i] = bands[i];
+        diff.stats.refreshedPixels += (uint32_t)bands[i].w * bands[i].h;
+    }
+    diff.stats.micros += micros() - start;
+    return numBands;
+}
+
+void PrintFrameDiffStats(const frameDiffStats &stats)
+{
+    Serial.printf("Frame diff: %lu pixels changed, %u rectangles covering %lu pixels (%.1f%% of the screen), %lu us\n",
+                  (unsigned long)stats.changedPixels, stats.rectangles, (unsigned long)stats.refreshedPixels,
+                  100.0 * stats.refreshedPixels / ((uint32_t)Panel::width * Panel::height), stats.micros);
+}
+
+bool DiffStoredFrame(const char *path, const uint8_t *frame, frameDiff &diff)
+{
+    FILE *stored = fopen(path, "rb");
+    if (stored == NULL)
+        return false;
+
+    // a few rows at a time, so the previous frame never needs a second frame-sized buffer
+    const int16_t rowsPerChunk = 16;
+    uint8_t rows[rowsPerChunk * Panel::stride];
+    BeginFrameDiff(diff);
+    for (int16_t y = 0; y < Panel::height; y += rowsPerChunk)
+    {
+        int16_t count = min(rowsPerChunk, (int16_t)(Panel::height - y));
+        if (fread(rows, Panel::stride, count, stored) != (size_t)count)
+        {
+            fclose(stored);
+            return false; // truncated, treat as no previous frame
+        }
+        DiffFrameRows(diff, y, count, rows, frame + y * Panel::stride);
+    }
+    fclose(stored);
+    return true;
+}
+
+bool StoreFrame(const char *path, const uint8_t *frame)
+{
+    FILE *stored = fopen(path, "wb");
+    if (stored == NULL)
+        return false;
+    bool written = fwrite(frame, Panel::stride, Panel::height, stored) == (size_t)Panel::height;
+    return fclose(stored) == 0 && written;
+}
@@ -0,0 +1,58 @@
+// Host build only ([env:fuzz_decoders] in platformio.ini): a libFuzzer target that feeds arbitrary
+// bodies to the forecast decoders, DataPointSource and OpenWeatherMapSource off a stream as the
+// station reads them, and DecodeForecast on a whole document as render_proxy does. Start it from
+// the recorded responses:
+//
+//   pio run -e fuzz_decoders
+//   mkdir -p fuzz_corpus && .pio/build/fuzz_decoders/program fuzz_corpus native/corpus/datapoint native/corpus/owm
+//
+// AddressSanitizer reports any read or write outside the buffers. Each input is held to about the
+// heap the station has free (HEAP_LIMIT in heapCounter.cpp), so one that makes the decoders hold more
+// aborts as a crash rather than passing on the host's memory. libFuzzer's own -malloc_limit_mb and
+// -rss_limit_mb only stop runaway single allocations and the whole process, at megabytes.
+//
+// The library's DecodeWeather (lib/ESP32-e-Paper-Weather-Display-master/src/common.h) is out of scope,
+// as for parse_bench: the station never calls it, and it decodes into the example sketches' globals.
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <string>
+
+#include <forecast.h>
+#include <heapCounter.h>
+#include <payloadStream.h>
+
+// About what an ESP32 has free with WiFi up and the display buffer allocated
+const size_t DeviceFreeHeap = 120 * 1024;
+
+static weatherRecord weatherRecords[maxNumRecords];
+
+static void CheckRecords(int numRecords)
+{
+    if (numRecords < 0 || numRecords > maxNumRecords)
+        abort(); // a decoder claiming records it cannot have written
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    Serial.mute(true);
+    const std::string payload((const char *)data, size);
+    StartHeapLimit(DeviceFreeHeap);
+
+    {
+        DynamicJsonDocument doc(ForecastDocumentSize); // the size GetSiteForecasts uses
+        PayloadStream body(payload);
+        CheckRecords(DataPointSource.decode(body, doc, weatherRecords, maxNumRecords));
+    }
+    {
+        DynamicJsonDocument doc(ForecastDocumentSize);
+        PayloadStream body(payload);
+        CheckRecords(OpenWeatherMapSource.decode(body, doc, weatherRecords, maxNumRecords));
+    }
+    {
+        DynamicJsonDocument doc(35 * 1024); // the size render_proxy parses a whole response into
+        if (!deserializeJson(doc, payload.data(), payload.size()))
+            CheckRecords(DecodeForecast(doc.as<JsonObject>(), weatherRecords, maxNumRecords));
+    }
+    StopHeapLimit();
+    return 0;
+}
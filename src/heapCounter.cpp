@@ -0,0 +1,171 @@
+#include <Arduino.h>
+#include <heapCounter.h>
+
+#ifdef HEAP_COUNTER
+#include <new>
+
+// The linker routes every malloc, calloc and realloc through these with -Wl,--wrap, and free too with HEAP_LIMIT
+#ifdef ARDUINO
+static volatile uint32_t heapAllocations = 0;
+#else
+// per thread on the host, where renderProxy --batch draws on several at once and each checks only its own
+static thread_local uint32_t heapAllocations = 0;
+#endif
+
+#if defined(HEAP_LIMIT) && !defined(ARDUINO)
+#include <malloc.h>
+
+// Bytes the thread holds that it allocated since StartHeapLimit, and the most it may; no limit when 0
+static thread_local long heapBytes = 0;
+static thread_local size_t heapLimit = 0;
+
+static void CountHeapBytes(long bytes)
+{
+    if (heapLimit == 0)
+        return;
+    heapBytes += bytes;
+    if (heapBytes > (long)heapLimit)
+    {
+        fprintf(stderr, "Heap limit exceeded: %ld bytes in use, limit %zu\n", heapBytes, heapLimit);
+        abort();
+    }
+}
+#endif
+
+extern "C"
+{
+    void *__real_malloc(size_t size);
+    void *__real_calloc(size_t count, size_t size);
+    void *__real_realloc(void *ptr, size_t size);
+
+#if defined(HEAP_LIMIT) && !defined(ARDUINO)
+    void __real_free(void *ptr);
+
+    void *__wrap_malloc(size_t size)
+    {
+        heapAllocations++;
+        void *block = __real_malloc(size);
+        if (block != NULL)
+            CountHeapBytes(malloc_usable_size(block));
+        return block;
+    }
+
+    void *__wrap_calloc(size_t count, size_t size)
+    {
+        heapAllocations++;
+        void *block = __real_calloc(count, size);
+        if (block != NULL)
+            CountHeapBytes(malloc_usable_size(block));
+        return block;
+    }
+
+    void *__wrap_realloc(void *ptr, size_t size)
+    {
+        heapAllocations++;
+        long before = ptr != NULL ? (long)malloc_usable_size(ptr) : 0;
+        void *block = __real_realloc(ptr, size);
+        if (block != NULL)
+            CountHeapBytes((long)malloc_usable_size(block) - before);
+        else if (size == 0)
+            CountHeapBytes(-before);
+        return block;
+    }
+
+    void __wrap_free(void *ptr)
+    {
+        if (ptr != NULL)
+            CountHeapBytes(-(long)malloc_usable_size(ptr));
+        __real_free(ptr);
+    }
+#else
+    void *__wrap_malloc(size_t size)
+    {
+        heapAllocations++;
+        return __real_malloc(size);
+    }
+
+    void *__wrap_calloc(size_t count, size_t size)
+    {
+        heapAllocations++;
+        return __real_calloc(count, size);
+    }
+
+    void *__wrap_realloc(void *ptr, size_t size)
+    {
+        heapAllocations++;
+        return __real_realloc(ptr, size);
+    }
+#endif
+}
+
+#if defined(__SANITIZE_ADDRESS__)
+#define ADDRESS_SANITIZER
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) // clangs older than __SANITIZE_ADDRESS__
+#define ADDRESS_SANITIZER
+#endif
+#endif
+
+#if !defined(ARDUINO) && !defined(ADDRESS_SANITIZER)
+// On the host libstdc++'s operator new calls malloc from inside the shared library, out of the
+// wrap's reach, so the host builds route it through the wrapped malloc here. AddressSanitizer
+// builds keep its own, which it needs to check new against delete
+void *operator new(size_t size)
+{
+    void *block = malloc(size);
+    if (block == NULL)
+        throw std::bad_alloc();
+    return block;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *block) noexcept
+{
+    free(block);
+}
+
+void operator delete[](void *block) noexcept
+{
+    free(block);
+}
+#endif
+
+uint32_t HeapAllocationCount()
+{
+    return heapAllocations;
+}
+
+void ReportHeapAllocations(const char *what, uint32_t countBefore)
+{
+    Serial.printf("Heap allocations during %s: %u\n", what, HeapAllocationCount() - countBefore);
+}
+
+#if defined(HEAP_LIMIT) && !defined(ARDUINO)
+void StartHeapLimit(size_t limitBytes)
+{
+    heapBytes = 0;
+    heapLimit = limitBytes;
+}
+
+void StopHeapLimit()
+{
+    heapLimit = 0;
+}
+#endif
+
+#else
+
+uint32_t HeapAllocationCount()
+{
+    return 0;
+}
+
+void ReportHeapAllocations(const char *what, uint32_t countBefore)
+{
+}
+
+#endif
@@ -8,9 +8,18 @@
 #include "time.h" // Built-in
 
 #include <weather.h>
+#include <forecast.h>
 #include <display.h>
+#include <panel.h>
+#include <layout.h>
+#include <battery.h>
+#include <energy.h>
+#include <heapCounter.h>
+#include <bootProfile.h>
+#include <gzipStream.h>
+#include <buffered_stream.h>
 
-String Time_str, Date_str; // strings to hold time and received weather data
+char Time_str[30], Date_str[30]; // time and date of the last update
 int wifi_signal, CurrentHour = 0, CurrentMin = 0, CurrentSec = 0;
 long StartTime = 0;
 
@@ -20,80 +29,150 @@ int SleepTime = 23;      // Sleep after (23+1) 00:00 to save battery power
 
 struct tm timeinfo;
 
-const int maxNumRecords = 40; // 5 days 3 hourly
-int numRecordsReceived = 0;
+batteryState BatteryState = BATTERY_NORMAL;
+
+const int numLocations = sizeof(ForecastLocations) / sizeof(ForecastLocations[0]);
+static_assert(numLocations <= MaxForecastSites, "more ForecastLocations than the screen has bands for");
+static_assert(numLocations <= SiteBandsMax, "more ForecastLocations than this panel's layout has bands for");
+
+// The record arena: each site takes the next slice, so the station holds maxNumRecords records however many sites it shows
 weatherRecord weatherRecords[maxNumRecords];
+siteForecast sites[numLocations];
 
-bool Get5DayWeatherRecord(WiFiClient &client)
+// Fetches one site from ForecastProvider into records, decoding the body as it arrives with doc;
+// returns how many records were read
+int Get5DayWeatherRecord(WiFiClient &client, const forecastLocation &location, JsonDocument &doc, weatherRecord *records, int maxRecords)
 {
     HTTPClient http;
+    int numRecordsReceived = 0;
+
+    char uri[160];
+    ForecastProvider.formatUri(uri, sizeof(uri), location, apikey, maxRecords);
 
     // http.begin(uri,test_root_ca); //HTTPS example connection
-    http.begin(client, "datapoint.metoffice.gov.uk", 80, metOfficeUri + apikey);
+    http.useHTTP10(true); // no chunked transfer encoding, so the body can be parsed straight off the socket
+    http.begin(client, forecastHost != NULL ? forecastHost : ForecastProvider.host, forecastPort, uri);
+    const char *responseHeaders[] = {"Content-Encoding"};
+    http.collectHeaders(responseHeaders, 1);
+    if (RequestGzip)
+        http.addHeader("Accept-Encoding", "gzip");
     int httpCode = http.GET();
     Serial.print("httpCode: ");
     Serial.println(httpCode);
     if (httpCode == HTTP_CODE_OK)
     {
-        WiFiClient json = http.getStream();
-        DynamicJsonDocument doc(35 * 1024);
-
-        DeserializationError error = deserializeJson(doc, json);
-        // Test if parsing succeeds.
-        if (error)
-        {
-            Serial.print(F("deserializeJson() failed: "));
-            Serial.println(error.c_str());
-            return false;
-        }
-        client.stop();
-        http.end();
+        WiFiClient &socket = http.getStream();
+        BufferedStream body(socket, HttpBodyBudgetMs);
+        Stream &json = BufferHttpBody ? (Stream &)body : (Stream &)socket;
 
-        JsonObject root = doc.as<JsonObject>();
-        JsonObject forecastRoot = root["SiteRep"]["DV"]["Location"];
-
-        Serial.println("Loading json");
-
-        int recordIndex = 0;
-        for (JsonObject day : forecastRoot["Period"].as<JsonArray>())
+        unsigned long parseStart = millis();
+        uint32_t allocationsBefore = HeapAllocationCount();
+        if (http.header("Content-Encoding") == "gzip")
         {
-            Serial.print("Day ");
-            String val = day["value"];
-            Serial.println(val);
-            for (JsonObject repItem : day["Rep"].as<JsonArray>())
+            GzipStream inflated(json);
+            if (!inflated.begin())
             {
-                String temp = repItem["T"];
-                weatherRecords[recordIndex].temperature = temp.toFloat();
-                String rain = repItem["Pp"];
-                weatherRecords[recordIndex].percentRain = rain.toFloat();
-                String weatherCode = repItem["W"];
-                weatherRecords[recordIndex].weatherCode = weatherCode.toInt();
-
-                struct tm tm = {0};
-                strptime(day["value"], "%Y-%m-%d", &tm);
-                String mins = repItem["$"];
-
-                int hour = mins.toInt() / 60;
-                tm.tm_hour = hour;
-                weatherRecords[recordIndex].time = tm;
-                recordIndex++;
+                client.stop();
+                http.end();
+                return 0;
             }
+            allocationsBefore = HeapAllocationCount(); // the inflater's window is not the parse's
+            numRecordsReceived = ForecastProvider.decode(inflated, doc, records, maxRecords);
+            Serial.printf("gzip: %u bytes received, %u inflated\n", inflated.compressedBytes(), inflated.inflatedBytes());
         }
-
-        numRecordsReceived = recordIndex;
+        else
+            numRecordsReceived = ForecastProvider.decode(json, doc, records, maxRecords);
+        ReportHeapAllocations("parse", allocationsBefore);
+        Serial.printf("%s: %d records parsed in %lu ms\n", ForecastProvider.name, numRecordsReceived, millis() - parseStart);
+        if (BufferHttpBody)
+            body.printStats("body");
+        client.stop(); // the rest of the body, if any, is not needed
     }
     else
     {
         Serial.printf("connection failed, error: %s", http.errorToString(httpCode).c_str());
         Serial.println();
         client.stop();
-        http.end();
-        return false;
     }
     http.end();
 
-    return true;
+    return numRecordsReceived; // a document without forecast periods is as good as no response
+}
+
+// Fetches every site in ForecastLocations in turn, all through one parse buffer, each into its share
+// of the record arena. True if at least one site has a forecast to show
+bool GetSiteForecasts(WiFiClient &client)
+{
+    const int recordsPerSite = maxNumRecords / numLocations;
+    DynamicJsonDocument doc(ForecastDocumentSize); // deserializeJson clears it for each period
+    int arenaUsed = 0;
+    bool gotWeather = false;
+    for (int i = 0; i < numLocations; i++)
+    {
+        const forecastLocation &location = ForecastLocations[i];
+        siteForecast &site = sites[i];
+        site.name = location.name;
+        site.latitude = location.latitude;
+        site.longitude = location.longitude;
+        site.records = weatherRecords + arenaUsed;
+        site.numRecords = 0;
+        for (byte attempts = 1; site.numRecords == 0 && attempts <= 2; attempts++) // Try up-to 2 time for each site
+            site.numRecords = Get5DayWeatherRecord(client, location, doc, site.records, recordsPerSite);
+        Serial.printf("%s: %d records\n", location.name, site.numRecords);
+        arenaUsed += site.numRecords;
+        gotWeather |= site.numRecords > 0;
+    }
+    return gotWeather;
+}
+
+#ifdef THIN_CLIENT
+// ETag of the frame on the panel, so an unchanged screen is neither downloaded nor refreshed
+RTC_DATA_ATTR char frameETag[48] = "";
+
+// Returns true when a new frame has been written into the panel and needs a refresh
+bool GetFrame(WiFiClient &client, const displayOptions &options)
+{
+    char uri[64];
+    snprintf(uri, sizeof(uri), "/frame?site=%s", renderProxySite);
+
+    HTTPClient http;
+    http.useHTTP10(true);
+    http.begin(client, renderProxyHost, renderProxyPort, uri);
+    const char *responseHeaders[] = {"Content-Encoding", "ETag"};
+    http.collectHeaders(responseHeaders, 2);
+    http.addHeader("Accept-Encoding", "gzip");
+    if (frameETag[0] != '\0')
+        http.addHeader("If-None-Match", frameETag);
+    int httpCode = http.GET();
+    Serial.print("httpCode: ");
+    Serial.println(httpCode);
+
+    bool written = false;
+    if (httpCode == HTTP_CODE_OK)
+    {
+        WiFiClient body = http.getStream();
+        const int frameBytes = Panel::stride * Panel::height;
+        if (http.header("Content-Encoding") == "gzip")
+        {
+            GzipStream inflated(body);
+            written = inflated.begin() && WriteFrame(inflated, options);
+        }
+        else if (http.getSize() != frameBytes)
+            Serial.printf("Frame is %d bytes, expected %d\n", http.getSize(), frameBytes);
+        else
+            written = WriteFrame(body, options);
+        if (written)
+            strlcpy(frameETag, http.header("ETag").c_str(), sizeof(frameETag));
+    }
+    else if (httpCode == HTTP_CODE_NOT_MODIFIED)
+        Serial.println("Frame unchanged");
+    else
+        Serial.printf("connection failed, error: %s\n", http.errorToString(httpCode).c_str());
+    client.stop();
+    http.end();
+    return written;
 }
+#endif
 
 uint8_t StartWiFi()
 {
@@ -136,20 +215,50 @@ void StopWiFi()
     WiFi.disconnect();
     WiFi.mode(WIFI_OFF);
 }
+long SleepDurationForBattery(batteryState state)
+{
+    switch (state)
+    {
+    case BATTERY_LOW:
+        return SleepDurationLowBattery;
+    case BATTERY_CRITICAL:
+        return SleepDurationCriticalBattery;
+    default:
+        return SleepDuration;
+    }
+}
+
+// Drop the secondary sections and use the cheaper partial refresh as the battery runs down
+displayOptions DisplayOptionsForBattery(batteryState state)
+{
+    displayOptions options;
+    options.showGraphs = state != BATTERY_CRITICAL;
+    options.showMoon = state == BATTERY_NORMAL;
+    options.partialRefresh = state != BATTERY_NORMAL;
+    options.statusLine = NULL;
+    return options;
+}
+
 void BeginSleep()
 {
+    SleepDuration = SleepDurationForBattery(BatteryState);
     long SleepTimer = (SleepDuration * 60 - ((CurrentMin % SleepDuration) * 60 + CurrentSec)); // Some ESP32 are too fast to maintain accurate time
-    esp_sleep_enable_timer_wakeup((SleepTimer + 20) * 1000000LL);                              // Added extra 20-secs of sleep to allow for slow ESP32 RTC timers
+    uint64_t sleepMicros = (SleepTimer + 20) * 1000000ULL;                                      // Added extra 20-secs of sleep to allow for slow ESP32 RTC timers
+    esp_sleep_enable_timer_wakeup(sleepMicros);
+
+    energyEstimate estimate = EstimateEnergy(EnergyModel, SleepTimer + 20);
+    PrintEnergyReport(estimate);
 
     Serial.println("Entering " + String(SleepTimer) + "-secs of sleep time");
     Serial.println("Awake for : " + String((millis() - StartTime) / 1000.0, 3) + "-secs");
     Serial.println("Starting deep-sleep period...");
+    MarkSleepStart(sleepMicros);
     esp_deep_sleep_start(); // Sleep for e.g. 30 minutes
 }
 
 boolean UpdateLocalTime()
 {
-    char time_output[30], day_output[30], update_time[30];
+    char update_time[30];
     while (!getLocalTime(&timeinfo, 10000))
     { // Wait for 10-sec for time to synchronise
         Serial.println("Failed to obtain time");
@@ -158,11 +267,9 @@ boolean UpdateLocalTime()
     CurrentHour = timeinfo.tm_hour;
     CurrentMin = timeinfo.tm_min;
     CurrentSec = timeinfo.tm_sec;
-    sprintf(day_output, "%s %02u-%s-%04u", weekday_D[timeinfo.tm_wday], timeinfo.tm_mday, month_M[timeinfo.tm_mon], (timeinfo.tm_year) + 1900);
+    snprintf(Date_str, sizeof(Date_str), "%s %02u-%s-%04u", weekday_D[timeinfo.tm_wday], timeinfo.tm_mday, month_M[timeinfo.tm_mon], (timeinfo.tm_year) + 1900);
     strftime(update_time, sizeof(update_time), "%H:%M:%S", &timeinfo); // Creates: '14:05:49'
-    sprintf(time_output, "%s %s", "Updated", update_time);
-    Date_str = day_output;
-    Time_str = time_output;
+    snprintf(Time_str, sizeof(Time_str), "%s %s", "Updated", update_time);
     return true;
 }
 
@@ -178,34 +285,65 @@ boolean SetupTime()
 
 void setup()
 {
+    MarkSetupStart();
     StartTime = millis();
     Serial.begin(115200);
+    PrintBootProfile();
 
     Serial.print("Start");
 
+    batteryThresholds thresholds = {BatteryLowVoltage, BatteryCriticalVoltage, BatteryHysteresis};
+    float batteryVoltage = ReadBatteryVoltage();
+    BatteryState = UpdateBatteryState(batteryVoltage, thresholds);
+    displayOptions options = DisplayOptionsForBattery(BatteryState);
+
+    char statusLine[64];
+    energyEstimate lastEstimate;
+    if (ShowEnergyStatusLine && LastEnergyEstimate(lastEstimate))
+    {
+        snprintf(statusLine, sizeof(statusLine), "%.3f mAh/cycle, %.0f days", lastEstimate.cycleMilliAmpHours, lastEstimate.projectedDays);
+        options.statusLine = statusLine;
+    }
+
+    BeginPhase(PHASE_WIFI);
     if (StartWiFi() == WL_CONNECTED && SetupTime() == true)
     {
         Serial.println("Wifi started");
+        BeginPhase(PHASE_HTTP);
 
-        InitDisplay(); // Give screen time to initialise by getting weather data!
-        byte Attempts = 1;
-        bool gotWeather = false;
-        WiFiClient client; // wifi client object
-        while (gotWeather == false && Attempts <= 2)
-        { // Try up-to 2 time for Weather and Forecast data
-            gotWeather = Get5DayWeatherRecord(client);
-            Serial.print("got weather? ");
-            Serial.println(gotWeather);
-            Attempts++;
+#ifdef THIN_CLIENT
+        WiFiClient client;
+        if (GetFrame(client, options))
+        {
+            StopWiFi();
+            BeginPhase(PHASE_REFRESH);
+            RefreshFrame();
         }
+#else
+        WiFiClient client; // wifi client object
+        bool gotWeather = GetSiteForecasts(client);
+        Serial.print("got weather? ");
+        Serial.println(gotWeather);
         if (gotWeather)
         {               // Only if received both Weather or Forecast proceed
             StopWiFi(); // Reduces power consumption while displaying weather data
+            BeginPhase(PHASE_RENDER);
 
-            DisplayWeather(weatherRecords, numRecordsReceived, &timeinfo, HomeLatitude, HomeLongitude);
+            // The display is only woken when the forecast or the time of day gives it something new to show
+            if (DisplayUpToDate(sites, numLocations, &timeinfo, options))
+            {
+                Serial.println("Forecast unchanged, display left as it is");
+            }
+            else
+            {
+                DisplayWeather(sites, numLocations, &timeinfo, options);
+            }
         }
+#endif
         //}
     }
+    LogBatteryVoltage(batteryVoltage, time(NULL)); // the RTC keeps time across deep sleep even if NTP failed this wake
+    PrintBatteryHistory();
     BeginSleep();
 }
 
@@ -0,0 +1,104 @@
+// Host build only ([env:moon_bench] in platformio.ini): checks the moon sprites against the circle
+// and line drawing they replaced, at both layout anchors and every phase, and times the two.
+//
+//   pio run -e moon_bench && .pio/build/moon_bench/program
+//
+// Exits non-zero if any sprite differs from the drawing by a pixel.
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <display.h>
+#include <moonSprites.h>
+#include <panel.h>
+
+// The drawing DrawMoon used before the sprites, for a phase from 0 to 1
+static void DrawMoonLines(Adafruit_GFX &target, int x, int y, double phase)
+{
+    const int diameter = 70;
+
+    // Draw dark part of moon
+    target.fillCircle(x + diameter - 1, y + diameter, diameter / 2 + 1, GxEPD_BLACK);
+    const int number_of_lines = 90;
+    for (double Ypos = 0; Ypos <= number_of_lines / 2; Ypos++)
+    {
+        double Xpos = sqrt(number_of_lines / 2 * number_of_lines / 2 - Ypos * Ypos);
+        // Determine the edges of the lighted part of the moon
+        double Rpos = 2 * Xpos;
+        double Xpos1, Xpos2;
+        if (phase < 0.5)
+        {
+            Xpos1 = -Xpos;
+            Xpos2 = Rpos - 2 * phase * Rpos - Xpos;
+        }
+        else
+        {
+            Xpos1 = Xpos;
+            Xpos2 = Xpos - 2 * phase * Rpos + Rpos;
+        }
+        // Draw light part of moon
+        double pW1x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
+        double pW1y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
+        double pW2x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
+        double pW2y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
+        double pW3x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
+        double pW3y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
+        double pW4x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
+        double pW4y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
+        target.drawLine(pW1x, pW1y, pW2x, pW2y, GxEPD_WHITE);
+        target.drawLine(pW3x, pW3y, pW4x, pW4y, GxEPD_WHITE);
+    }
+    target.drawCircle(x + diameter - 1, y + diameter, diameter / 2, GxEPD_BLACK);
+}
+
+// Pixels that differ between the two canvases
+static long CountDifferences(const GFXcanvas1 &a, const GFXcanvas1 &b)
+{
+    long differences = 0;
+    for (int16_t y = 0; y < Panel::height; y++)
+    {
+        for (int16_t x = 0; x < Panel::width; x++)
+            differences += a.getPixel(x, y) != b.getPixel(x, y);
+    }
+    return differences;
+}
+
+int main()
+{
+    GFXcanvas1 lines(Panel::width, Panel::height), sprites(Panel::width, Panel::height);
+    renderContext context;
+    BeginRenderContext(context, sprites);
+
+    // the moon's anchors in LayoutAfternoon and LayoutMorning
+    const int anchors[] = {157, 503};
+    const int y = 90;
+    long mismatched = 0;
+    for (int x : anchors)
+    {
+        for (int i = 0; i < MoonSpritePhases; i++)
+        {
+            int angle = i * 360 / MoonSpritePhases;
+            lines.fillScreen(GxEPD_WHITE);
+            sprites.fillScreen(GxEPD_WHITE);
+            // scripts/gen_moon_sprites.py renders sprite i at this phase
+            DrawMoonLines(lines, x, y, (i * 360.0 / MoonSpritePhases + 180) / 360);
+            DrawMoon(context, x, y, angle);
+            long differences = CountDifferences(lines, sprites);
+            if (differences > 0)
+                printf("anchor %d, angle %d: %ld pixels differ\n", x, angle, differences);
+            mismatched += differences;
+        }
+    }
+
+    const int repeats = 2000;
+    unsigned long start = micros();
+    for (int i = 0; i < repeats; i++)
+        DrawMoonLines(lines, anchors[0], y, 0.7);
+    unsigned long linesMicros = micros() - start;
+    start = micros();
+    for (int i = 0; i < repeats; i++)
+        DrawMoon(context, anchors[0], y, (i * 45) % 360);
+    unsigned long spriteMicros = micros() - start;
+
+    printf("moon: lines %.2f us, sprite %.2f us per draw; %ld pixels differ\n", (double)linesMicros / repeats,
+           (double)spriteMicros / repeats, mismatched);
+    return mismatched == 0 ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include <forecast.h>
+
+// OpenWeatherMap's 3 hourly forecast (/data/2.5/forecast) as the station's records. Its condition IDs
+// are mapped onto the DataPoint weather codes the display draws icons for
+// (docs/metoffice-weather-code-guide.txt), using the night variant where DataPoint has one
+
+// The DataPoint code for an OWM condition ID, https://openweathermap.org/weather-conditions
+static int WeatherCodeFromCondition(int id, bool night)
+{
+    int day; // the day code; where DataPoint has a night variant it is day - 1
+    bool hasNight = true;
+    if (id >= 200 && id < 300)
+        return 30; // thunder
+    if (id >= 300 && id < 400)
+        return 11; // drizzle
+    switch (id)
+    {
+    case 500:
+    case 501:
+        return 12; // light rain
+    case 502:
+    case 503:
+    case 504:
+        return 15; // heavy rain
+    case 511:
+    case 611:
+    case 615:
+    case 616:
+        return 18; // sleet, or rain and snow
+    case 520:
+    case 521:
+    case 531:
+        day = 10; // light rain shower
+        break;
+    case 522:
+        day = 14; // heavy rain shower
+        break;
+    case 600:
+    case 601:
+        return 24; // light snow
+    case 602:
+        return 27; // heavy snow
+    case 612:
+    case 613:
+        day = 17; // sleet shower
+        break;
+    case 620:
+    case 621:
+        day = 23; // light snow shower
+        break;
+    case 622:
+        day = 26; // heavy snow shower
+        break;
+    case 741:
+        return 6; // fog
+    case 781:
+        return 30; // tornado, drawn as thunder
+    case 800:
+        day = 1; // clear
+        break;
+    case 801:
+    case 802:
+        day = 3; // partly cloudy
+        break;
+    case 803:
+        return 7; // cloudy
+    case 804:
+        return 8; // overcast
+    default:
+        hasNight = false;
+        day = id >= 700 && id < 800 ? 5 : 7; // mist, haze, smoke and dust; cloudy for anything new
+        break;
+    }
+    return night && hasNight ? day - 1 : day;
+}
+
+static void FormatOpenWeatherMapUri(char *uri, size_t size, const forecastLocation &location, const char *apikey, int maxRecords)
+{
+    // cnt so only the periods kept are sent
+    snprintf(uri, size, "/data/2.5/forecast?lat=%.4f&lon=%.4f&cnt=%d&units=metric&appid=%s", location.latitude, location.longitude,
+             maxRecords, apikey);
+}
+
+// Skips to "list" and deserializes its periods one by one
+static int DecodeOpenWeatherMapBody(Stream &body, JsonDocument &doc, weatherRecord *records, int maxRecords)
+{
+    if (!FindArray(body, "list"))
+    {
+        Serial.println("No forecast periods in the response");
+        return 0;
+    }
+    int recordIndex = 0;
+    do
+    {
+        DeserializationError error = deserializeJson(doc, body);
+        if (error)
+        {
+            Serial.printf("Forecast period %d: %s\n", recordIndex, error.c_str());
+            return 0;
+        }
+        JsonObject period = doc.as<JsonObject>();
+        weatherRecord &record = records[recordIndex++];
+        record.temperature = period["main"]["temp"] | 0.0f;
+        record.percentRain = (period["pop"] | 0.0f) * 100; // probability, 0 to 1
+        const char *partOfDay = period["sys"]["pod"] | "d";
+        record.weatherCode = WeatherCodeFromCondition(period["weather"][0]["id"] | 0, partOfDay[0] == 'n');
+        time_t when = period["dt"].as<long>();
+        localtime_r(&when, &record.time); // in the TZ SetupTime set, as the station shows it
+    } while (recordIndex < maxRecords && NextArrayElement(body));
+    return recordIndex;
+}
+
+const forecastSource OpenWeatherMapSource = {"OpenWeatherMap", "api.openweathermap.org", FormatOpenWeatherMapUri, DecodeOpenWeatherMapBody};
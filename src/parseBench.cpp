@@ -0,0 +1,228 @@
+// Host build only ([env:parse_bench] in platformio.ini): times the station's forecast parse over the
+// recorded responses in native/corpus, so a parser change comes with a number.
+//
+//   pio run -e parse_bench && .pio/build/parse_bench/program native/corpus/*/*.json
+//
+// Each response goes through its provider's forecastSource decoder, DataPointSource or
+// OpenWeatherMapSource, period by period off a stream exactly as Get5DayWeatherRecord runs them.
+// The library's own DecodeWeather (lib/ESP32-e-Paper-Weather-Display-master/src/common.h) is out of
+// scope: the station never calls it, and it decodes into the example sketches' globals.
+//
+// Files listed in native/corpus/expected.txt (next to the provider directories) must decode to the
+// number of records given there, and the run fails when one does not; other files are just timed.
+//
+// A run's output saved to a file can be given back with --baseline, and each payload's time per
+// parse is then shown against the saved one:
+//
+//   .pio/build/parse_bench/program native/corpus/*/*.json > parse_baseline.txt
+//   (change the parser and rebuild)
+//   .pio/build/parse_bench/program --baseline parse_baseline.txt native/corpus/*/*.json
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <forecast.h>
+#include <heapCounter.h>
+#include <payloadStream.h>
+
+// Tracks the heap the JSON document takes, the parse's only allocation. Other heap use is not
+// counted here, which is what HEAP_COUNTER checks: the decode itself must not allocate at all
+static size_t heapInUse = 0;
+static size_t heapPeak = 0;
+
+struct CountingAllocator
+{
+    void *allocate(size_t size)
+    {
+        size_t *block = (size_t *)malloc(sizeof(size_t) + size);
+        if (block == NULL)
+            return NULL;
+        *block = size;
+        heapInUse += size;
+        heapPeak = max(heapPeak, heapInUse);
+        return block + 1;
+    }
+
+    void deallocate(void *pointer)
+    {
+        if (pointer == NULL)
+            return;
+        size_t *block = (size_t *)pointer - 1;
+        heapInUse -= *block;
+        free(block);
+    }
+
+    void *reallocate(void *pointer, size_t size)
+    {
+        void *moved = allocate(size);
+        if (moved != NULL && pointer != NULL)
+        {
+            memcpy(moved, pointer, min(size, ((size_t *)pointer)[-1]));
+            deallocate(pointer);
+        }
+        return moved;
+    }
+};
+
+typedef BasicJsonDocument<CountingAllocator> benchDocument;
+
+static weatherRecord weatherRecords[maxNumRecords];
+
+// records each file should decode to, by provider directory and file name ("datapoint/normal.json"),
+// loaded from each corpus directory's expected.txt as its files come up
+static std::map<std::string, int> expectedRecords;
+static std::map<std::string, bool> expectedLoaded;
+
+// The payload's name in its corpus, and the corpus directory it is in
+static std::string CorpusName(const std::string &path, std::string &corpus)
+{
+    size_t file = path.rfind('/');
+    size_t provider = file == std::string::npos || file == 0 ? std::string::npos : path.rfind('/', file - 1);
+    if (provider == std::string::npos)
+    {
+        corpus = ".";
+        return path;
+    }
+    corpus = path.substr(0, provider);
+    return path.substr(provider + 1);
+}
+
+// The records expected from the file at path, -1 when its corpus does not list it
+static int ExpectedRecords(const char *path)
+{
+    std::string corpus;
+    std::string name = CorpusName(path, corpus);
+    if (!expectedLoaded[corpus])
+    {
+        expectedLoaded[corpus] = true;
+        std::ifstream file(corpus + "/expected.txt");
+        std::string line;
+        while (std::getline(file, line))
+        {
+            char listed[128];
+            int records;
+            if (line[0] != '#' && sscanf(line.c_str(), "%127s %d", listed, &records) == 2)
+                expectedRecords[corpus + "/" + listed] = records;
+        }
+    }
+    std::map<std::string, int>::const_iterator expected = expectedRecords.find(corpus + "/" + name);
+    return expected == expectedRecords.end() ? -1 : expected->second;
+}
+
+// time per parse in ns by payload file name, from --baseline
+static std::map<std::string, double> baseline;
+
+// Reads a previous run's output; the lines of results are name, payload, iterations, time per parse
+static bool LoadBaseline(const char *path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line))
+    {
+        char source[32], name[128];
+        unsigned long iterations;
+        double nsPerParse;
+        if (sscanf(line.c_str(), "%31s %127s %lu %lf ns", source, name, &iterations, &nsPerParse) == 4)
+            baseline[name] = nsPerParse;
+    }
+    return true;
+}
+
+static int ParseOnce(const std::string &payload, const forecastSource &source, uint32_t &allocations)
+{
+    benchDocument doc(ForecastDocumentSize); // the size GetSiteForecasts uses
+    PayloadStream body(payload);
+    uint32_t allocationsBefore = HeapAllocationCount(); // the document's pool is the one allocation, made above
+    int records = source.decode(body, doc, weatherRecords, maxNumRecords);
+    allocations = HeapAllocationCount() - allocationsBefore;
+    return records;
+}
+
+static bool Benchmark(const char *path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string payload = contents.str();
+    const forecastSource &source = payload.find("\"SiteRep\"") != std::string::npos ? DataPointSource : OpenWeatherMapSource;
+
+    heapPeak = heapInUse;
+    uint32_t allocations;
+    int records = ParseOnce(payload, source, allocations);
+    size_t peak = heapPeak;
+    if (allocations > 0)
+    {
+        fprintf(stderr, "%s: %u heap allocations while decoding\n", path, allocations);
+        return false;
+    }
+    int expected = ExpectedRecords(path);
+    char result[32];
+    if (expected < 0)
+        snprintf(result, sizeof(result), "unchecked");
+    else if (records == expected)
+        snprintf(result, sizeof(result), "ok");
+    else
+        snprintf(result, sizeof(result), "FAIL, expected %d", expected);
+
+    // at least 200 ms of repeats, as a benchmark library would, so short payloads still time well
+    const unsigned long minMicros = 200000;
+    unsigned long iterations = 0;
+    unsigned long start = micros();
+    unsigned long elapsed;
+    do
+    {
+        ParseOnce(payload, source, allocations);
+        iterations++;
+        elapsed = micros() - start;
+    } while (elapsed < minMicros);
+
+    double nsPerParse = elapsed * 1000.0 / iterations;
+    const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    char change[24] = "";
+    std::map<std::string, double>::const_iterator saved = baseline.find(name);
+    if (saved != baseline.end())
+        snprintf(change, sizeof(change), "  %+.1f%%", (nsPerParse / saved->second - 1) * 100);
+    printf("%-15s %-30s %8lu %11.0f ns %11.0f ns %8.1f MB/s %7d %9zu B  %s%s\n",
+           source.name, name, iterations, nsPerParse, records > 0 ? nsPerParse / records : 0.0,
+           payload.size() * 1000.0 / nsPerParse, records, peak, result, change);
+    return expected < 0 || records == expected;
+}
+
+int main(int argc, char **argv)
+{
+    int first = 1;
+    if (argc > 2 && strcmp(argv[1], "--baseline") == 0)
+    {
+        if (!LoadBaseline(argv[2]))
+            return 2;
+        first = 3;
+    }
+    if (first >= argc)
+    {
+        fprintf(stderr, "usage: %s [--baseline previous-run.txt] response.json...\n", argv[0]);
+        return 2;
+    }
+    Serial.mute(true); // the DataPoint decoder logs each day, which would be most of what is timed
+    printf("%-15s %-30s %8s %14s %14s %13s %7s %11s  %s\n", "source", "payload", "iters", "time/parse", "time/record",
+           "throughput", "records", "JSON heap", baseline.empty() ? "result" : "result vs baseline");
+    int failed = 0;
+    for (int i = first; i < argc; i++)
+    {
+        if (!Benchmark(argv[i]))
+            failed++;
+    }
+    return failed == 0 ? 0 : 1;
+}
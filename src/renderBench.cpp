@@ -0,0 +1,70 @@
+// Host build only ([env:render_bench] and its per panel variants in platformio.ini): times DrawWeather
+// drawing the panel's whole screen, with one site and with as many sites as its layout has bands for.
+//
+//   pio run -e render_bench_420 && .pio/build/render_bench_420/program
+//
+// The forecast is made up rather than fetched, the same every run, so runs compare panel against panel.
+// Host time says which layout draws more, not how long the ESP32 takes to draw it.
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <display.h>
+#include <panel.h>
+#include <layout.h>
+
+static weatherRecord records[40];
+
+// 5 days 3 hourly from start, the temperature on a daily swing and every weather code in turn
+static void MakeForecast(time_t start)
+{
+    for (int i = 0; i < 40; i++)
+    {
+        time_t when = start + i * 3 * 3600L;
+        localtime_r(&when, &records[i].time);
+        records[i].temperature = 10 + 5 * sin(i / 3.0);
+        records[i].percentRain = (i * 37) % 100;
+        records[i].weatherCode = i % 31;
+    }
+}
+
+// Microseconds per DrawWeather of numSites sites, each showing the same records
+static double TimeFrames(GFXcanvas1 &canvas, int numSites, tm *timeNow, const displayOptions &options, int repeats)
+{
+    siteForecast sites[SiteBandsMax];
+    for (int i = 0; i < numSites; i++)
+        sites[i] = {"Site", 51.48, -3.18, records, 40};
+
+    renderContext context;
+    BeginRenderContext(context, canvas);
+    unsigned long start = micros();
+    for (int i = 0; i < repeats; i++)
+    {
+        canvas.fillScreen(GxEPD_WHITE);
+        DrawWeather(context, sites, numSites, timeNow, options);
+    }
+    return (double)(micros() - start) / repeats;
+}
+
+int main(int argc, char **argv)
+{
+    int repeats = argc > 1 ? atoi(argv[1]) : 200;
+    setenv("TZ", "GMT0BST,M3.5.0/01,M10.5.0/02", 1);
+    tzset();
+    Serial.mute(true); // DisplayMoonPhase reports the phase every frame
+
+    GFXcanvas1 canvas(Panel::width, Panel::height);
+    displayOptions options = {true, true, false, "status"};
+    const time_t times[] = {1792300000, 1792340000}; // a morning and an afternoon, for both layout tables
+    const char *names[] = {"morning", "afternoon"};
+
+    for (int t = 0; t < 2; t++)
+    {
+        tm timeNow;
+        localtime_r(&times[t], &timeNow);
+        MakeForecast(times[t]);
+        double oneSite = TimeFrames(canvas, 1, &timeNow, options, repeats);
+        double allSites = TimeFrames(canvas, SiteBandsMax, &timeNow, options, repeats);
+        printf("%s %dx%d %s: %.1f us one site, %.1f us %d sites per frame\n", EPD_PANEL_NAME, Panel::width, Panel::height,
+               names[t], oneSite, allSites, SiteBandsMax);
+    }
+    return 0;
+}
@@ -0,0 +1,246 @@
+// Host build only ([env:render_proxy] in platformio.ini): draws one station's screen with the
+// station's own display code and writes the 1 bpp frame, for scripts/render_proxy.py to serve.
+// With --batch it stays running and renders sites from stdin on a pool of threads, each with its
+// own frame and fonts, which is how scripts/render_fleet.py renders a whole fleet.
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <display.h>
+#include <forecast.h>
+#include <heapCounter.h>
+#include <panel.h>
+
+// What one rendering thread keeps from site to site: the decoded records, the JSON document they
+// are decoded from, and the frame with the fonts drawing into it
+struct renderer
+{
+    weatherRecord records[maxNumRecords];
+    DynamicJsonDocument doc;
+    GFXcanvas1 canvas;
+    renderContext context;
+
+    renderer() : doc(35 * 1024), canvas(Panel::width, Panel::height) { BeginRenderContext(context, canvas); }
+};
+
+// TZ is one setting for the whole process, and localtime_r reads it while decoding and drawing.
+// Renders in the zone already set run side by side; one for another zone waits for them to finish
+class timezoneLock
+{
+public:
+    void acquire(const std::string &timezone)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return active == 0 || current == timezone; });
+        if (current != timezone)
+        {
+            // the station renders in its own local time, as set by SetupTime on the device
+            setenv("TZ", timezone.c_str(), 1);
+            tzset();
+            current = timezone;
+        }
+        active++;
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        active--;
+        changed.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::string current;
+    int active = 0;
+};
+
+static timezoneLock TimezoneLock;
+
+// Decodes forecast and draws its screen into r.canvas, in the caller's thread
+static bool RenderSite(renderer &r, const char *name, const std::string &forecast, double latitude, double longitude, time_t now,
+                       const std::string &timezone)
+{
+    TimezoneLock.acquire(timezone);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+
+    bool ok = false;
+    int numRecords = 0;
+    DeserializationError error = deserializeJson(r.doc, forecast);
+    if (error)
+        fprintf(stderr, "%s: %s\n", name, error.c_str());
+    else if ((numRecords = DecodeForecast(r.doc.as<JsonObject>(), r.records, maxNumRecords)) == 0)
+        fprintf(stderr, "%s: no forecast records\n", name);
+    else
+    {
+        displayOptions options;
+        options.showGraphs = true;
+        options.showMoon = true;
+        options.partialRefresh = false;
+        options.statusLine = NULL;
+
+        // the same rows the panel would get, drawn in one pass into a buffer of our own
+        r.canvas.fillScreen(GxEPD_WHITE);
+        siteForecast site = {"", latitude, longitude, r.records, numRecords};
+        uint32_t allocationsBefore = HeapAllocationCount();
+        DrawWeather(r.context, &site, 1, &timeinfo, options);
+        uint32_t allocations = HeapAllocationCount() - allocationsBefore;
+        ok = allocations == 0;
+        // the station draws with no heap to spare, so a frame that allocates here is a regression
+        if (!ok)
+            fprintf(stderr, "%s: %u heap allocations while drawing\n", name, allocations);
+    }
+    TimezoneLock.release();
+    return ok;
+}
+
+typedef struct
+{
+    std::string site;
+    double latitude;
+    double longitude;
+    long long now;
+    std::string timezone;
+    std::string forecast;
+} renderJob;
+
+// Jobs read from stdin, taken by whichever thread is free next
+class jobQueue
+{
+public:
+    void push(renderJob &&job)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        ready.notify_one();
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        ready.notify_all();
+    }
+
+    // false once the queue is closed and empty
+    bool pop(renderJob &job)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [&]() { return closed || !jobs.empty(); });
+        if (jobs.empty())
+            return false;
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<renderJob> jobs;
+    bool closed = false;
+};
+
+static std::mutex OutputMutex;
+
+static void RenderWorker(jobQueue &jobs)
+{
+    renderer r;
+    renderJob job;
+    while (jobs.pop(job))
+    {
+        unsigned long start = micros();
+        bool ok = RenderSite(r, job.site.c_str(), job.forecast, job.latitude, job.longitude, (time_t)job.now, job.timezone);
+        unsigned long renderMicros = micros() - start;
+
+        std::lock_guard<std::mutex> lock(OutputMutex);
+        if (ok)
+        {
+            printf("%s ok %lu\n", job.site.c_str(), renderMicros);
+            fwrite(r.canvas.getBuffer(), Panel::stride, Panel::height, stdout);
+        }
+        else
+            printf("%s error\n", job.site.c_str());
+        fflush(stdout);
+    }
+}
+
+// Each job is a line "site latitude longitude unix-time posix-tz forecast-bytes" followed by that many
+// bytes of forecast JSON. Each answer, in the order the renders finish, is a line "site ok render-us"
+// followed by the frame's Panel::stride * Panel::height bytes, or "site error"
+static int RenderBatch(int numThreads)
+{
+    Serial.mute(true); // DisplayMoonPhase reports every frame; errors still go to stderr
+
+    jobQueue jobs;
+    std::vector<std::thread> workers;
+    for (int i = 0; i < numThreads; i++)
+        workers.emplace_back(RenderWorker, std::ref(jobs));
+
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        std::istringstream fields(line);
+        renderJob job;
+        size_t forecastBytes;
+        if (!(fields >> job.site >> job.latitude >> job.longitude >> job.now >> job.timezone >> forecastBytes))
+        {
+            fprintf(stderr, "bad job: %s\n", line.c_str());
+            break; // the forecast that follows can't be skipped without its length
+        }
+        job.forecast.resize(forecastBytes);
+        if (!std::cin.read(&job.forecast[0], forecastBytes))
+        {
+            fprintf(stderr, "%s: forecast truncated\n", job.site.c_str());
+            break;
+        }
+        jobs.push(std::move(job));
+    }
+    jobs.close();
+    for (std::thread &worker : workers)
+        worker.join();
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc == 2 || argc == 3) && strcmp(argv[1], "--batch") == 0)
+    {
+        int numThreads = argc == 3 ? atoi(argv[2]) : (int)std::thread::hardware_concurrency();
+        return RenderBatch(max(1, numThreads));
+    }
+    if (argc != 7)
+    {
+        fprintf(stderr, "usage: %s forecast.json latitude longitude unix-time posix-tz frame.bin\n", argv[0]);
+        fprintf(stderr, "       %s --batch [threads] < jobs\n", argv[0]);
+        return 2;
+    }
+
+    std::ifstream in(argv[1]);
+    std::string forecast((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    renderer r;
+    if (!RenderSite(r, argv[1], forecast, atof(argv[2]), atof(argv[3]), (time_t)atoll(argv[4]), argv[5]))
+        return 1;
+
+    FILE *out = fopen(argv[6], "wb");
+    if (out == NULL || fwrite(r.canvas.getBuffer(), Panel::stride, Panel::height, out) != (size_t)Panel::height)
+    {
+        fprintf(stderr, "%s: write failed\n", argv[6]);
+        if (out != NULL)
+            fclose(out);
+        return 1;
+    }
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Sunrise and sunset from CalculateSunTimes against the SunSet library it replaced on the device
+#include <Arduino.h>
+#include <astronomy.h>
+#include <sunset.h>
+#include <unity.h>
+
+// either library may give UTC minutes outside 0-1439 away from the Greenwich meridian
+static int MinutesApart(double a, double b)
+{
+    int apart = ((int)lround(a - b)) % 1440;
+    return apart > 720 ? apart - 1440 : (apart < -720 ? apart + 1440 : apart);
+}
+
+// one day at a time and as a horizon run, which carries the day of the year across the run
+static void CheckLatitude(float latitude, float longitude, int toleranceMinutes)
+{
+    const long firstDay = DaysFromCivil(2024, 1, 1); // a leap year, ending in a run into 2025
+    SunSet sun;
+    sun.setPosition(latitude, longitude, 0);
+    for (long day = firstDay; day < firstDay + 366; day++)
+    {
+        time_t when = day * 86400L;
+        struct tm date;
+        gmtime_r(&when, &date);
+        sun.setCurrentDate(date.tm_year + 1900, date.tm_mon + 1, date.tm_mday);
+
+        int16_t sunrise[AstronomyHorizonDays], sunset[AstronomyHorizonDays];
+        CalculateSunTimes(day, AstronomyHorizonDays, latitude, longitude, sunrise, sunset);
+        char message[64];
+        snprintf(message, sizeof(message), "latitude %.2f, %04d-%02d-%02d", latitude, date.tm_year + 1900,
+                 date.tm_mon + 1, date.tm_mday);
+        TEST_ASSERT_INT_WITHIN_MESSAGE(toleranceMinutes, 0, MinutesApart(sunrise[0], sun.calcSunriseUTC()), message);
+        TEST_ASSERT_INT_WITHIN_MESSAGE(toleranceMinutes, 0, MinutesApart(sunset[0], sun.calcSunsetUTC()), message);
+
+        // the last day of the run is the same date calculated on its own
+        int16_t lastSunrise, lastSunset;
+        CalculateSunTimes(day + AstronomyHorizonDays - 1, 1, latitude, longitude, &lastSunrise, &lastSunset);
+        TEST_ASSERT_INT_WITHIN_MESSAGE(1, 0, MinutesApart(sunrise[AstronomyHorizonDays - 1], lastSunrise), message);
+        TEST_ASSERT_INT_WITHIN_MESSAGE(1, 0, MinutesApart(sunset[AstronomyHorizonDays - 1], lastSunset), message);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// The low precision equations drift further from SunSet as the sun's path gets shallower. Against a double
+// precision transcription of the NOAA calculation SunSet is built on, the worst day of the year was 2 minutes
+// out at the equator, 3 up to 52 degrees and 5 at 60; each tolerance allows a minute more for the
+// library's own rounding. They have not been confirmed with SunSet itself, pio test -e native_test does that
+void test_equator(void) { CheckLatitude(0.0f, 0.0f, 3); }
+void test_southern(void) { CheckLatitude(-33.9f, 18.4f, 4); }
+void test_mid_latitude(void) { CheckLatitude(35.0f, -106.6f, 4); }
+void test_home(void) { CheckLatitude(51.48f, -3.18f, 4); }
+void test_high_latitude(void) { CheckLatitude(60.0f, 10.7f, 6); }
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_equator);
+    RUN_TEST(test_southern);
+    RUN_TEST(test_mid_latitude);
+    RUN_TEST(test_home);
+    RUN_TEST(test_high_latitude);
+    return UNITY_END();
+}
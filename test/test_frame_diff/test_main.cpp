@@ -0,0 +1,126 @@
+// The partial refresh rectangles from frameDiff.cpp: whatever the frames and however many rectangles
+// the caller takes, every pixel that changed must be inside one of them
+#include <Arduino.h>
+#include <frameDiff.h>
+#include <unity.h>
+
+const uint32_t FrameBytes = (uint32_t)Panel::stride * Panel::height;
+static uint8_t previous[FrameBytes], current[FrameBytes];
+static frameDiff diff;
+
+static bool Pixel(const uint8_t *frame, int16_t x, int16_t y)
+{
+    return frame[y * Panel::stride + x / 8] & (0x80 >> (x % 8));
+}
+
+static void FlipPixel(uint8_t *frame, int16_t x, int16_t y)
+{
+    frame[y * Panel::stride + x / 8] ^= 0x80 >> (x % 8);
+}
+
+// a new frame from the previous one: a few changed blocks, like widgets redrawn, and some lone pixels
+static void ChangeFrame(int blocks, int pixels)
+{
+    memcpy(current, previous, FrameBytes);
+    for (int i = 0; i < blocks; i++)
+    {
+        int16_t x = random(Panel::width), y = random(Panel::height);
+        int16_t w = random(1, Panel::width - x + 1), h = random(1, min(80, Panel::height - y) + 1);
+        for (int16_t row = y; row < y + h; row++)
+            for (int16_t column = x; column < x + w; column++)
+                if (random(3) == 0)
+                    FlipPixel(current, column, row);
+    }
+    for (int i = 0; i < pixels; i++)
+        FlipPixel(current, random(Panel::width), random(Panel::height));
+}
+
+// diffs previous against current a band of rows at a time, as the paged renderer does
+static int Diff(frameRect *rects, int maxRects)
+{
+    BeginFrameDiff(diff);
+    for (int16_t y = 0; y < Panel::height; y += 16)
+        DiffFrameRows(diff, y, min(16, Panel::height - y), previous + y * Panel::stride, current + y * Panel::stride);
+    return FinishFrameDiff(diff, rects, maxRects);
+}
+
+static void CheckCovered(const frameRect *rects, int numRects, int maxRects)
+{
+    TEST_ASSERT_TRUE(numRects <= maxRects);
+    uint32_t changed = 0;
+    for (int i = 0; i < numRects; i++)
+    {
+        TEST_ASSERT_TRUE(rects[i].x >= 0 && rects[i].y >= 0 && rects[i].w > 0 && rects[i].h > 0);
+        TEST_ASSERT_TRUE(rects[i].x + rects[i].w <= Panel::width && rects[i].y + rects[i].h <= Panel::height);
+        TEST_ASSERT_TRUE(rects[i].x % 32 == 0 && rects[i].w % 32 == 0);
+    }
+    for (int16_t y = 0; y < Panel::height; y++)
+    {
+        for (int16_t x = 0; x < Panel::width; x++)
+        {
+            if (Pixel(previous, x, y) == Pixel(current, x, y))
+                continue;
+            changed++;
+            bool covered = false;
+            for (int i = 0; i < numRects && !covered; i++)
+                covered = x >= rects[i].x && x < rects[i].x + rects[i].w && y >= rects[i].y && y < rects[i].y + rects[i].h;
+            char message[48];
+            snprintf(message, sizeof(message), "pixel %d,%d changed outside the rectangles", x, y);
+            TEST_ASSERT_TRUE_MESSAGE(covered, message);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(changed, diff.stats.changedPixels);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_unchanged_frame_has_no_rectangles(void)
+{
+    randomSeed(1);
+    for (uint32_t i = 0; i < FrameBytes; i++)
+        previous[i] = random(256);
+    memcpy(current, previous, FrameBytes);
+    frameRect rects[FRAME_DIFF_MAX_RECTS];
+    TEST_ASSERT_EQUAL_INT(0, Diff(rects, FRAME_DIFF_MAX_RECTS));
+}
+
+void test_changed_pixels_are_covered(void)
+{
+    randomSeed(2);
+    for (int pair = 0; pair < 200; pair++)
+    {
+        for (uint32_t i = 0; i < FrameBytes; i++)
+            previous[i] = random(256);
+        ChangeFrame(random(0, 12), random(0, 20));
+        int maxRects = random(1, FRAME_DIFF_MAX_RECTS + 1);
+        frameRect rects[FRAME_DIFF_MAX_RECTS];
+        int numRects = Diff(rects, maxRects);
+        CheckCovered(rects, numRects, maxRects);
+    }
+}
+
+void test_stored_frame_diffs_like_rows(void)
+{
+    randomSeed(3);
+    for (uint32_t i = 0; i < FrameBytes; i++)
+        previous[i] = random(256);
+    ChangeFrame(3, 5);
+    const char *path = "test_frame_diff.bin";
+    TEST_ASSERT_TRUE(StoreFrame(path, previous));
+    TEST_ASSERT_TRUE(DiffStoredFrame(path, current, diff));
+    frameRect rects[FRAME_DIFF_MAX_RECTS];
+    int numRects = FinishFrameDiff(diff, rects, FRAME_DIFF_MAX_RECTS);
+    remove(path);
+    CheckCovered(rects, numRects, FRAME_DIFF_MAX_RECTS);
+    TEST_ASSERT_FALSE(DiffStoredFrame(path, current, diff));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_unchanged_frame_has_no_rectangles);
+    RUN_TEST(test_changed_pixels_are_covered);
+    RUN_TEST(test_stored_frame_diffs_like_rows);
+    return UNITY_END();
+}
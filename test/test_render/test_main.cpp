@@ -0,0 +1,118 @@
+// The screen as render_proxy draws it on the host: its frames are only worth serving if the text
+// reaches the canvas, which a missing font or a U8g2 that is not connected would silently lose
+#include <Arduino.h>
+#include <display.h>
+#include <panel.h>
+#include <thread>
+#include <unity.h>
+
+const int numRecords = 40;
+static weatherRecord weatherRecords[numRecords];
+static GFXcanvas1 before(Panel::width, Panel::height), after(Panel::width, Panel::height);
+static struct tm timeNow;
+
+void setUp(void)
+{
+    setenv("TZ", "GMT0BST,M3.5.0/01,M10.5.0/02", 1);
+    tzset();
+    time_t now = 1792300000; // a Tuesday in October, mid morning
+    localtime_r(&now, &timeNow);
+    for (int i = 0; i < numRecords; i++)
+    {
+        time_t period = now + i * 3 * 3600L;
+        localtime_r(&period, &weatherRecords[i].time);
+        weatherRecords[i].temperature = 10 + i % 7;
+        weatherRecords[i].percentRain = i * 37 % 100;
+        weatherRecords[i].weatherCode = i % 30;
+    }
+}
+
+void tearDown(void) {}
+
+static void Render(GFXcanvas1 &canvas, const siteForecast *sites, int numSites, const displayOptions &options)
+{
+    canvas.fillScreen(GxEPD_WHITE);
+    renderContext context;
+    BeginRenderContext(context, canvas);
+    DrawWeather(context, sites, numSites, &timeNow, options);
+}
+
+// rows of the pixels that differ between the two frames, -1 if none do
+static void DifferingRows(int16_t &first, int16_t &last)
+{
+    first = last = -1;
+    for (int16_t y = 0; y < Panel::height; y++)
+    {
+        for (int16_t x = 0; x < Panel::width; x++)
+        {
+            if (before.getPixel(x, y) != after.getPixel(x, y))
+            {
+                if (first < 0)
+                    first = y;
+                last = y;
+                break;
+            }
+        }
+    }
+}
+
+void test_status_line_is_drawn(void)
+{
+    siteForecast site = {"", 51.48f, -3.18f, weatherRecords, numRecords};
+    displayOptions options = {true, true, false, NULL};
+    Render(before, &site, 1, options);
+    options.statusLine = "3.7V 0.125 mAh/cycle";
+    Render(after, &site, 1, options);
+
+    int16_t first, last;
+    DifferingRows(first, last);
+    TEST_ASSERT_TRUE_MESSAGE(first >= 0, "the status line drew nothing");
+    TEST_ASSERT_TRUE_MESSAGE(first >= Panel::height - 14, "the status line drew above its widget's rows");
+}
+
+void test_site_names_are_drawn(void)
+{
+    siteForecast sites[2] = {{"", 51.48f, -3.18f, weatherRecords, 20},
+                             {"", 51.45f, -2.58f, weatherRecords + 20, 20}};
+    displayOptions options = {true, true, false, NULL};
+    Render(before, sites, 2, options);
+    sites[0].name = "Home";
+    sites[1].name = "Work";
+    Render(after, sites, 2, options);
+
+    int16_t first, last;
+    DifferingRows(first, last);
+    TEST_ASSERT_TRUE_MESSAGE(first >= 0, "the site names drew nothing");
+}
+
+// renderProxy --batch draws on several threads at once, each into its own canvas with its own context,
+// so two screens for different places drawn at once must come out as each does alone
+void test_concurrent_renders_match(void)
+{
+    siteForecast north = {"", 60.0f, 10.7f, weatherRecords, numRecords};
+    siteForecast south = {"", -33.9f, 18.4f, weatherRecords, numRecords};
+    displayOptions options = {true, true, false, "status"};
+    GFXcanvas1 northAlone(Panel::width, Panel::height), southAlone(Panel::width, Panel::height);
+    Render(northAlone, &north, 1, options);
+    Render(southAlone, &south, 1, options);
+
+    const size_t frameBytes = Panel::stride * Panel::height;
+    for (int round = 0; round < 20; round++)
+    {
+        std::thread first([&]() { Render(before, &north, 1, options); });
+        std::thread second([&]() { Render(after, &south, 1, options); });
+        first.join();
+        second.join();
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(northAlone.getBuffer(), before.getBuffer(), frameBytes, "northern frame changed");
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(southAlone.getBuffer(), after.getBuffer(), frameBytes, "southern frame changed");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_status_line_is_drawn);
+    RUN_TEST(test_site_names_are_drawn);
+    RUN_TEST(test_concurrent_renders_match);
+    return UNITY_END();
+}